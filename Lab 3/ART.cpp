@@ -0,0 +1,761 @@
+//==============================================================================================
+// File: ART.cpp - Adaptive radix tree implementation
+// c.f.: ART.h
+//
+// Our other trees compare whole words at every node, even though the words near each other
+// in a big tree mostly start with the same letters, so most of every comparison goes over
+// bytes that the comparison before it already looked at. A radix tree (or trie) instead goes
+// down one byte of the word at a time: the node at depth d only looks at byte d of the word to
+// pick a child, so no byte is ever looked at twice and the height depends on the length of the
+// words, not on how many there are.
+//
+// A plain trie would need 256 child pointers in every node, which is a lot of wasted memory for
+// nodes that only have a couple of children. The adaptive radix tree (Leis, Kemper and Neumann,
+// 2013) fixes that two ways:
+//
+//  - Nodes come in four sizes (4, 16, 48 and 256 children), and a node that fills up is swapped
+//    for the next bigger size, so each node is only about as big as the children it has.
+//  - A chain of nodes with one child each is compressed into a prefix on the node below the
+//    chain, so a word only has as many nodes as the places where it branches off from the rest.
+//
+// We include each word's terminating zero as its last byte, so that no word is a prefix of
+// another (without it, "the" would end in the middle of the path to "there"). Every word then
+// ends in its own leaf, and the children of a node in key byte order are in alphabetical order.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "ART.h"
+#include "Bits.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ART_SSE2 1
+#include <emmintrin.h>
+#endif
+
+ART::ART()
+{
+	// constructor -- there is nothing to do, since an empty tree is just a nullptr root.
+}
+
+ART::~ART()
+{
+	// On deconstruction, we delete every node and leaf, starting from the root.
+	//
+	destroy(root);
+}
+
+void ART::destroy(void* p)
+{
+	// This method deletes the given child and everything below it. The recursion is at most as
+	// deep as the longest word, so we don't need a stack of our own like the BST does.
+	//
+	if (p == nullptr)
+	{
+		return;
+	}
+
+	if (isLeaf(p))
+	{
+		delete asLeaf(p);
+
+		return;
+	}
+
+	innerNode* n = (innerNode*)p;
+
+	switch (n->type)
+	{
+	case NODE4:
+		for (int i = 0; i < n->numberOfChildren; i++) destroy(((node4*)n)->children[i]);
+		delete (node4*)n;
+		break;
+	case NODE16:
+		for (int i = 0; i < n->numberOfChildren; i++) destroy(((node16*)n)->children[i]);
+		delete (node16*)n;
+		break;
+	case NODE48:
+		for (int i = 0; i < n->numberOfChildren; i++) destroy(((node48*)n)->children[i]);
+		delete (node48*)n;
+		break;
+	case NODE256:
+		for (int i = 0; i < 256; i++) destroy(((node256*)n)->children[i]);
+		delete (node256*)n;
+		break;
+	}
+}
+
+ART::leaf* ART::newLeaf(const char word[50])
+{
+	leaf* l = new leaf();
+
+	strcpy(l->word, word);
+	numberOfLeaves++;
+
+	return l;
+}
+
+void ART::insert(const char word[50])
+{
+	// This method goes down the tree one key byte at a time, checking each node's prefix on the
+	// way. There are four ways it can end:
+	//
+	//  1. The tree is empty, so the word's leaf becomes the root.
+	//  2. We reach a leaf. If it is our word, we count it. Otherwise, the two words share the bytes
+	//     up to where they differ, so we replace the leaf with a Node4 whose prefix is those bytes
+	//     and whose two children are the old leaf and our new one.
+	//  3. Our word differs from a node's prefix. We put a Node4 above the node with the part of the
+	//     prefix that matched, and hang the node (with what is left of its prefix) and our new
+	//     leaf from it.
+	//  4. A node has no child for our next byte, so we add our new leaf as one.
+	//
+	size_t length = strlen(word) + 1; // The number of key bytes, which includes the terminating zero
+	void** ref = &root;	// Where the node we are on hangs from, so that we can replace it
+	size_t depth = 0;	// The number of key bytes the nodes above us have already checked
+	size_t nodesLookedAt = 0; // The number of nodes we have gone through, for our depth histogram
+
+	while (true)
+	{
+		void* p = *ref;
+
+		if (p == nullptr) // Case 1: the tree is empty.
+		{
+			*ref = tagLeaf(newLeaf(word));
+			insertDepths.record(nodesLookedAt);
+
+			return;
+		}
+
+		if (isLeaf(p)) // Case 2: we reached a leaf.
+		{
+			leaf* l = asLeaf(p);
+			size_t i = depth;
+
+			insertDepths.record(++nodesLookedAt); // Whatever happens next, the leaf is the last node we look at.
+
+			// We compare the bytes no node has checked yet. Both words end in a zero, so
+			// reaching the end of ours means they are the same.
+			while (i < length && l->word[i] == word[i])
+			{
+				numberOfByteComparisons++;
+				i++;
+			}
+
+			if (i == length) // If they are the same word, we count it.
+			{
+				l->count++;
+
+				return;
+			}
+
+			numberOfByteComparisons++; // The byte they differ at was compared too.
+
+			leaf* newWord = newLeaf(word);
+			node4* n = new node4();
+
+			numberOfNode4s++;
+			numberOfLeafSplits++;
+
+			n->prefix = newWord->word + depth;		// The bytes the words share after depth become the new node's prefix,
+			n->prefixLength = (unsigned int)(i - depth);
+
+			addChild(ref, n, (unsigned char)l->word[i], p);	// and it branches on the byte they differ at.
+			addChild(ref, n, (unsigned char)word[i], tagLeaf(newWord));
+
+			*ref = n;
+
+			return;
+		}
+
+		innerNode* n = (innerNode*)p;
+
+		numberOfNodesVisited++;
+		nodesLookedAt++;
+
+		if (n->prefixLength > 0) // If this node has a compressed path, we check our word against it.
+		{
+			unsigned int matched = 0;
+
+			// A prefix never contains a word's terminating zero, so if our word ends inside the prefix,
+			// its zero is where it stops matching and we never read past the end of it.
+			while (matched < n->prefixLength && n->prefix[matched] == word[depth + matched])
+			{
+				numberOfByteComparisons++;
+				matched++;
+			}
+
+			if (matched < n->prefixLength) // Case 3: our word leaves the compressed path partway through.
+			{
+				numberOfByteComparisons++;
+
+				node4* parent = new node4();
+				unsigned char oldByte = (unsigned char)n->prefix[matched];
+
+				numberOfNode4s++;
+				numberOfPrefixSplits++;
+
+				parent->prefix = n->prefix;			// The new node gets the part of the path that matched,
+				parent->prefixLength = matched;
+
+				n->prefix += matched + 1;			// and the old node keeps what is left after the byte that differs.
+				n->prefixLength -= matched + 1;
+
+				addChild(ref, parent, oldByte, n);
+				addChild(ref, parent, (unsigned char)word[depth + matched], tagLeaf(newLeaf(word)));
+
+				*ref = parent;
+				insertDepths.record(nodesLookedAt);
+
+				return;
+			}
+
+			depth += n->prefixLength;
+		}
+
+		void** next = findChild(n, (unsigned char)word[depth]);
+
+		if (next == nullptr) // Case 4: there is no child for our next byte, so our leaf becomes one.
+		{
+			addChild(ref, n, (unsigned char)word[depth], tagLeaf(newLeaf(word)));
+			insertDepths.record(nodesLookedAt);
+
+			return;
+		}
+
+		ref = next; // Otherwise, we go down to that child, which checks the next byte.
+		depth++;
+	}
+}
+
+unsigned int ART::find(const char word[50])
+{
+	// This method goes down the tree the same way insert does, but stops as soon as the word
+	// can't be in the tree.
+	//
+	size_t length = strlen(word) + 1;
+	void* p = root;
+	size_t depth = 0;
+	size_t nodesLookedAt = 0; // The number of nodes we have gone through, for our depth histogram
+
+	while (p != nullptr)
+	{
+		if (isLeaf(p)) // If we reach a leaf, it is the only word that could be ours.
+		{
+			leaf* l = asLeaf(p);
+
+			lookupDepths.record(++nodesLookedAt);
+
+			for (size_t i = depth; i < length; i++)
+			{
+				numberOfByteComparisons++;
+
+				if (l->word[i] != word[i])
+				{
+					return 0;
+				}
+			}
+
+			return l->count;
+		}
+
+		innerNode* n = (innerNode*)p;
+
+		numberOfNodesVisited++;
+		nodesLookedAt++;
+
+		for (unsigned int i = 0; i < n->prefixLength; i++) // Every byte of the compressed path has to match.
+		{
+			numberOfByteComparisons++;
+
+			if (n->prefix[i] != word[depth + i])
+			{
+				lookupDepths.record(nodesLookedAt);
+
+				return 0;
+			}
+		}
+
+		depth += n->prefixLength;
+
+		void** next = findChild(n, (unsigned char)word[depth]);
+
+		p = next != nullptr ? *next : nullptr;
+		depth++;
+	}
+
+	lookupDepths.record(nodesLookedAt);
+
+	return 0;
+}
+
+unsigned int ART::depthOf(const char* word) const
+{
+	// This method goes down the tree like find does, without counting anything, and returns
+	// the number of nodes it went through once it gets to the word's leaf. Since it only
+	// looks for words that are in the tree, it doesn't need to check the compressed paths.
+	//
+	size_t length = strlen(word) + 1;
+	void* p = root;
+	size_t depth = 0;
+	unsigned int nodesLookedAt = 0;
+
+	while (p != nullptr)
+	{
+		nodesLookedAt++;
+
+		if (isLeaf(p))
+		{
+			return strcmp(asLeaf(p)->word, word) == 0 ? nodesLookedAt : 0;
+		}
+
+		innerNode* n = (innerNode*)p;
+
+		depth += n->prefixLength;
+
+		if (depth >= length)
+		{
+			return 0;
+		}
+
+		unsigned char byte = (unsigned char)word[depth];
+		void* next = nullptr;
+
+		switch (n->type) // We find the child the same way findChild does, without its counters.
+		{
+		case NODE4:
+			for (int i = 0; i < n->numberOfChildren; i++) if (((node4*)n)->keys[i] == byte) next = ((node4*)n)->children[i];
+			break;
+		case NODE16:
+			for (int i = 0; i < n->numberOfChildren; i++) if (((node16*)n)->keys[i] == byte) next = ((node16*)n)->children[i];
+			break;
+		case NODE48:
+			if (((node48*)n)->childIndex[byte] != 0) next = ((node48*)n)->children[((node48*)n)->childIndex[byte] - 1];
+			break;
+		case NODE256:
+			next = ((node256*)n)->children[byte];
+			break;
+		}
+
+		p = next;
+		depth++;
+	}
+
+	return 0;
+}
+
+void** ART::findChild(innerNode* n, unsigned char byte)
+{
+	// This method finds the slot of the child for the given key byte, which is different for each kind of node.
+	//
+	switch (n->type)
+	{
+	case NODE4: // A Node4 is small enough that we just look at each key.
+	{
+		node4* p = (node4*)n;
+
+		for (int i = 0; i < p->numberOfChildren; i++)
+		{
+			numberOfByteComparisons++;
+
+			if (p->keys[i] == byte)
+			{
+				return &p->children[i];
+			}
+		}
+
+		return nullptr;
+	}
+	case NODE16: // A Node16 compares all of its keys at once, and ignores the keys past its last child.
+	{
+		node16* p = (node16*)n;
+		unsigned int mask;
+
+		numberOfByteComparisons += p->numberOfChildren;
+
+#ifdef ART_SSE2
+		__m128i keys = _mm_loadu_si128((const __m128i*)p->keys);
+
+		mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(keys, _mm_set1_epi8((char)byte)));
+#else
+		mask = 0;
+
+		for (int i = 0; i < 16; i++)
+		{
+			mask |= (unsigned int)(p->keys[i] == byte) << i;
+		}
+#endif
+
+		mask &= (1u << p->numberOfChildren) - 1;
+
+		return mask != 0 ? &p->children[countTrailingZeros(mask)] : nullptr;
+	}
+	case NODE48: // A Node48 looks the key up in its index.
+	{
+		node48* p = (node48*)n;
+
+		return p->childIndex[byte] != 0 ? &p->children[p->childIndex[byte] - 1] : nullptr;
+	}
+	default: // A Node256 has a slot for every key.
+	{
+		node256* p = (node256*)n;
+
+		return p->children[byte] != nullptr ? &p->children[byte] : nullptr;
+	}
+	}
+}
+
+void ART::addChild(void** ref, innerNode* n, unsigned char byte, void* child)
+{
+	// This method adds a child for a key byte the node doesn't have yet. If the node is full,
+	// we grow it first. Node4s and Node16s keep their keys sorted, so we shift the bigger keys
+	// (and their children) over by one to make room.
+	//
+	if ((n->type == NODE4 && n->numberOfChildren == 4) || (n->type == NODE16 && n->numberOfChildren == 16) ||
+		(n->type == NODE48 && n->numberOfChildren == 48))
+	{
+		n = grow(ref, n);
+	}
+
+	switch (n->type)
+	{
+	case NODE4:
+	case NODE16:
+	{
+		unsigned char* keys = n->type == NODE4 ? ((node4*)n)->keys : ((node16*)n)->keys;
+		void** children = n->type == NODE4 ? ((node4*)n)->children : ((node16*)n)->children;
+		int i = n->numberOfChildren;
+
+		while (i > 0 && keys[i - 1] > byte) // We shift every bigger key over by one,
+		{
+			keys[i] = keys[i - 1];
+			children[i] = children[i - 1];
+			i--;
+		}
+
+		keys[i] = byte; // and put ours in the gap.
+		children[i] = child;
+		break;
+	}
+	case NODE48:
+	{
+		node48* p = (node48*)n;
+
+		p->children[p->numberOfChildren] = child; // We never remove children, so the next free slot is always the one after the last.
+		p->childIndex[byte] = (unsigned char)(p->numberOfChildren + 1);
+		break;
+	}
+	case NODE256:
+		((node256*)n)->children[byte] = child;
+		break;
+	}
+
+	n->numberOfChildren++;
+}
+
+ART::innerNode* ART::grow(void** ref, innerNode* n)
+{
+	// This method copies a full node into a new node of the next bigger kind, puts the new
+	// node where the old one was, and deletes the old one.
+	//
+	innerNode* bigger;
+
+	numberOfNodeGrowths++;
+
+	if (n->type == NODE4) // A Node4's sorted keys become the first four keys of a Node16.
+	{
+		node4* p = (node4*)n;
+		node16* q = new node16();
+
+		memcpy(q->keys, p->keys, sizeof(p->keys));
+		memcpy(q->children, p->children, sizeof(p->children));
+
+		bigger = q;
+		numberOfNode4s--;
+		numberOfNode16s++;
+	}
+	else if (n->type == NODE16) // A Node16's children go in the first slots of a Node48, indexed by their keys.
+	{
+		node16* p = (node16*)n;
+		node48* q = new node48();
+
+		for (int i = 0; i < 16; i++)
+		{
+			q->childIndex[p->keys[i]] = (unsigned char)(i + 1);
+			q->children[i] = p->children[i];
+		}
+
+		bigger = q;
+		numberOfNode16s--;
+		numberOfNode48s++;
+	}
+	else // A Node48's children go straight into the slots of their keys in a Node256.
+	{
+		node48* p = (node48*)n;
+		node256* q = new node256();
+
+		for (int b = 0; b < 256; b++)
+		{
+			if (p->childIndex[b] != 0)
+			{
+				q->children[b] = p->children[p->childIndex[b] - 1];
+			}
+		}
+
+		bigger = q;
+		numberOfNode48s--;
+		numberOfNode256s++;
+	}
+
+	bigger->numberOfChildren = n->numberOfChildren; // The new node has the same children and the same compressed path.
+	bigger->prefixLength = n->prefixLength;
+	bigger->prefix = n->prefix;
+
+	if (*ref == n) // If the old node is in the tree already, the new one takes its place.
+	{
+		*ref = bigger;
+	}
+
+	switch (n->type)
+	{
+	case NODE4: delete (node4*)n; break;
+	case NODE16: delete (node16*)n; break;
+	default: delete (node48*)n; break;
+	}
+
+	return bigger;
+}
+
+void ART::collect(void* p, vector<WordCount>& result) const
+{
+	// This method visits the children of every node in key byte order, which is alphabetical
+	// order, adding each leaf's word to result when it gets there.
+	//
+	if (p == nullptr)
+	{
+		return;
+	}
+
+	if (isLeaf(p))
+	{
+		result.push_back({ asLeaf(p)->word, asLeaf(p)->count });
+
+		return;
+	}
+
+	innerNode* n = (innerNode*)p;
+
+	switch (n->type)
+	{
+	case NODE4:
+		for (int i = 0; i < n->numberOfChildren; i++) collect(((node4*)n)->children[i], result);
+		break;
+	case NODE16:
+		for (int i = 0; i < n->numberOfChildren; i++) collect(((node16*)n)->children[i], result);
+		break;
+	case NODE48:
+		for (int b = 0; b < 256; b++)
+		{
+			if (((node48*)n)->childIndex[b] != 0)
+			{
+				collect(((node48*)n)->children[((node48*)n)->childIndex[b] - 1], result);
+			}
+		}
+		break;
+	case NODE256:
+		for (int b = 0; b < 256; b++) collect(((node256*)n)->children[b], result);
+		break;
+	}
+}
+
+vector<WordCount> ART::words() const
+{
+	vector<WordCount> result;
+
+	result.reserve((size_t)numberOfLeaves);
+	collect(root, result);
+
+	return result;
+}
+
+void ART::list()
+{
+	// This method prints out every word in the tree in the same indexed list the other datatypes print.
+	//
+	vector<WordCount> sortedWords = words();
+
+	if (sortedWords.empty()) // If there are no words, we just say so.
+	{
+		cout << "Set is empty" << endl;
+
+		return;
+	}
+
+	cout << "Set contains: ";
+
+	for (size_t i = 0; i < sortedWords.size(); i++)
+	{
+		if (i != 0) // Every word after the first is separated from the one before it by a comma.
+		{
+			cout << ", ";
+		}
+
+		cout << "(" << i + 1 << ") " << sortedWords[i].word << " " << sortedWords[i].count;
+	}
+
+	cout << endl;
+}
+
+unsigned int ART::getHeight()
+{
+	unsigned int height = 0;
+
+	calculateHeight(root, height, 1);
+
+	return height;
+}
+
+void ART::calculateHeight(void* p, unsigned int& height, unsigned int traversalHeight)
+{
+	// This method finds the deepest leaf below the given child, keeping the deepest depth it has seen in height.
+	//
+	if (p == nullptr)
+	{
+		return;
+	}
+
+	if (isLeaf(p))
+	{
+		if (traversalHeight > height)
+		{
+			height = traversalHeight;
+		}
+
+		return;
+	}
+
+	innerNode* n = (innerNode*)p;
+
+	switch (n->type)
+	{
+	case NODE4:
+		for (int i = 0; i < n->numberOfChildren; i++) calculateHeight(((node4*)n)->children[i], height, traversalHeight + 1);
+		break;
+	case NODE16:
+		for (int i = 0; i < n->numberOfChildren; i++) calculateHeight(((node16*)n)->children[i], height, traversalHeight + 1);
+		break;
+	case NODE48:
+		for (int i = 0; i < n->numberOfChildren; i++) calculateHeight(((node48*)n)->children[i], height, traversalHeight + 1);
+		break;
+	case NODE256:
+		for (int b = 0; b < 256; b++) calculateHeight(((node256*)n)->children[b], height, traversalHeight + 1);
+		break;
+	}
+}
+
+const DepthHistogram& ART::getLookupDepths() const
+{
+	return lookupDepths;
+}
+
+unsigned long long ART::getByteComparisons()
+{
+	return numberOfByteComparisons;
+}
+
+unsigned long long ART::getMemoryUsage()
+{
+	// We keep count of how many of each kind of node there are, so this is just a sum.
+	//
+	return numberOfLeaves * sizeof(leaf) + numberOfNode4s * sizeof(node4) + numberOfNode16s * sizeof(node16) +
+		numberOfNode48s * sizeof(node48) + numberOfNode256s * sizeof(node256);
+}
+
+unsigned long long ART::getAllocatedBytes()
+{
+	unsigned long long bytes = 0;
+
+	addAllocatedBytes(root, bytes);
+
+	return bytes;
+}
+
+void ART::addAllocatedBytes(void* p, unsigned long long& bytes)
+{
+	// This method adds up how big the allocator says the block of the given child and every
+	// block below it really is.
+	//
+	if (p == nullptr)
+	{
+		return;
+	}
+
+	if (isLeaf(p))
+	{
+		bytes += MemoryUsage::allocatedSize(asLeaf(p));
+
+		return;
+	}
+
+	innerNode* n = (innerNode*)p;
+
+	bytes += MemoryUsage::allocatedSize(n);
+
+	switch (n->type)
+	{
+	case NODE4:
+		for (int i = 0; i < n->numberOfChildren; i++) addAllocatedBytes(((node4*)n)->children[i], bytes);
+		break;
+	case NODE16:
+		for (int i = 0; i < n->numberOfChildren; i++) addAllocatedBytes(((node16*)n)->children[i], bytes);
+		break;
+	case NODE48:
+		for (int i = 0; i < n->numberOfChildren; i++) addAllocatedBytes(((node48*)n)->children[i], bytes);
+		break;
+	case NODE256:
+		for (int b = 0; b < 256; b++) addAllocatedBytes(((node256*)n)->children[b], bytes);
+		break;
+	}
+}
+
+void ART::displayStatistics()
+{
+	// This method displays statistics related to the number of words in the tree, the kinds of
+	// nodes it is made of, and the work done as words are inserted.
+	//
+	vector<WordCount> allWords = words();
+	unsigned long long numWords = 0; // We add up the counts of every leaf to get the total number of words.
+
+	for (const WordCount& w : allWords)
+	{
+		numWords += w.count;
+	}
+
+	unsigned long long liveBytes = getMemoryUsage(); // We also find out how much memory the nodes take up,
+	unsigned long long allocatedBytes = getAllocatedBytes(); // and how much the allocator really set aside for them.
+
+	cout << "ART Stats:\n"; // Print out a header specifying that these are ART stats
+	cout << "Distinct Words: " << numberOfLeaves << "\n"; // Print out the total number of unique words
+	cout << "Total Words: " << numWords << "\n"; // Print out the total number of words
+	cout << "Height: " << getHeight() << "\n"; // Print out the height of the tree
+	cout << "Node4s: " << numberOfNode4s << " (" << sizeof(node4) << " bytes each)\n"; // Print out the number of each kind of node,
+	cout << "Node16s: " << numberOfNode16s << " (" << sizeof(node16) << " bytes each)\n"; // and how big each kind is
+	cout << "Node48s: " << numberOfNode48s << " (" << sizeof(node48) << " bytes each)\n";
+	cout << "Node256s: " << numberOfNode256s << " (" << sizeof(node256) << " bytes each)\n";
+	cout << "Leaves: " << numberOfLeaves << " (" << sizeof(leaf) << " bytes each)\n";
+	cout << "Live Bytes: " << liveBytes << "\n"; // Print out the number of bytes the nodes take up
+	cout << "Allocated Bytes: " << allocatedBytes << "\n"; // Print out the number of bytes the allocator set aside for them
+	cout << "Allocator Overhead: " << (allocatedBytes > liveBytes ? allocatedBytes - liveBytes : 0) << " bytes\n"; // Print out how much of that is rounding
+	cout << "Bytes per Distinct Word: " << (numberOfLeaves > 0 ? (double)allocatedBytes / numberOfLeaves : 0) << "\n"; // Print out what each distinct word costs
+	cout << "Byte Comparisons: " << numberOfByteComparisons << "\n"; // Print out the total number of key bytes compared
+	cout << "Inner Nodes Visited: " << numberOfNodesVisited << "\n"; // Print out the number of inner nodes passed through
+	cout << "Leaf Splits: " << numberOfLeafSplits << "\n"; // Print out the number of leaves split into a Node4
+	cout << "Prefix Splits: " << numberOfPrefixSplits << "\n"; // Print out the number of compressed paths split
+	cout << "Node Growths: " << numberOfNodeGrowths << "\n"; // Print out the number of times a node was replaced by a bigger one
+	insertDepths.display("Insert Depths"); // Print out how many nodes each insert went through
+
+	// Print out how many nodes a search for each of the ten most frequent words goes through.
+	displayWordDepths("Top Word Depths", selectTopK(allWords, 10), [this](const char* word) { return depthOf(word); });
+}
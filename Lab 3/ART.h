@@ -0,0 +1,124 @@
+//==============================================================================================
+// File: ART.h - Adaptive radix tree
+// Header for ART.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "Statistics.h"
+#include "MemoryUsage.h"
+#include "WordQuery.h"
+#include "DepthHistogram.h"
+
+using namespace std;
+
+class ART
+{
+public:
+	ART();
+	~ART();
+
+	void insert(const char word[50]); // adds a word to the tree
+	void list(); // Prints a list of all words in the tree.
+	void displayStatistics(); // Displays statistics about the tree operations performed.
+
+	// Returns the number of times the word has been inserted, or zero if it isn't in the tree
+	unsigned int find(const char word[50]);
+
+	vector<WordCount> words() const; // Returns every word in the tree, in alphabetical order
+	unsigned long long getByteComparisons(); // Returns the number of key bytes compared so far
+	unsigned int getHeight(); // Returns the number of nodes on the longest path from the root to a word, including the word's leaf
+	unsigned long long getMemoryUsage(); // Returns the number of bytes taken up by the nodes and leaves of the tree
+	unsigned long long getAllocatedBytes(); // Returns the number of bytes the allocator set aside for the nodes and leaves of the tree
+	const DepthHistogram& getLookupDepths() const; // Returns the depths of every find so far
+private:
+	// The kinds of inner nodes. Each one holds up to the number of children in its name, and a
+	// node that fills up is replaced by the next bigger kind.
+	enum nodeType : unsigned char
+	{
+		NODE4,
+		NODE16,
+		NODE48,
+		NODE256
+	};
+
+	// Every word ends in a leaf, which is where its count is kept.
+	struct leaf
+	{
+		unsigned int count = 1;	// The amount of times the word has been inserted into the tree
+		char word[50] = {};		// The word of the leaf
+	};
+
+	// What every kind of inner node starts with. The prefix is the compressed path: the bytes
+	// every word below this node has in common that no node above it checked. Those bytes are
+	// also in the words of the leaves below, so instead of copying them we point into one of them.
+	struct innerNode
+	{
+		nodeType type;							// Which kind of node this is
+		unsigned short numberOfChildren = 0;	// The number of children the node has
+		unsigned int prefixLength = 0;			// The number of bytes in the prefix
+		const char* prefix = nullptr;			// The first byte of the prefix, inside the word of a leaf below this node
+	};
+
+	// The children of Node4s and Node16s are kept sorted by their key byte, and a Node16 compares
+	// all of its keys at once with SSE2. A Node48 has a byte per possible key that holds the
+	// child's slot plus one (or zero for no child), and a Node256 has a slot for every key.
+	struct node4 : innerNode { unsigned char keys[4] = {}; void* children[4] = {}; node4() { type = NODE4; } };
+	struct node16 : innerNode { unsigned char keys[16] = {}; void* children[16] = {}; node16() { type = NODE16; } };
+	struct node48 : innerNode { unsigned char childIndex[256] = {}; void* children[48] = {}; node48() { type = NODE48; } };
+	struct node256 : innerNode { void* children[256] = {}; node256() { type = NODE256; } };
+
+	// A child can be an inner node or a leaf. We tell them apart by setting the lowest bit of
+	// pointers to leaves, which is always zero otherwise since leaves are aligned.
+	static bool isLeaf(void* p) { return ((uintptr_t)p & 1) != 0; }
+	static leaf* asLeaf(void* p) { return (leaf*)((uintptr_t)p & ~(uintptr_t)1); }
+	static void* tagLeaf(leaf* p) { return (void*)((uintptr_t)p | 1); }
+
+	leaf* newLeaf(const char word[50]); // Returns a new leaf for the given word
+	void** findChild(innerNode* n, unsigned char byte); // Returns the child slot of the given key byte, or nullptr if there isn't one
+
+	// Adds a child under the given key byte, growing the node first if it is full. ref is where the node hangs from.
+	void addChild(void** ref, innerNode* n, unsigned char byte, void* child);
+
+	// Replaces a full node with one of the next bigger kind, returning it. ref is where the node hangs from.
+	innerNode* grow(void** ref, innerNode* n);
+
+	// Returns the number of nodes (including the leaf) a search for the word goes through, or zero if
+	// it isn't in the tree. This doesn't count toward any statistics.
+	unsigned int depthOf(const char* word) const;
+
+	void destroy(void* p); // Deletes the given child and everything below it
+	void collect(void* p, vector<WordCount>& result) const; // Adds every word below the given child to result, in alphabetical order
+
+	// Recursively calculates the height of the tree by traversing through the given child and its children
+	void calculateHeight(void* p, unsigned int& height, unsigned int traversalHeight);
+
+	void addAllocatedBytes(void* p, unsigned long long& bytes); // Adds the allocated size of the given child and everything below it to bytes
+
+	void* root = nullptr; // The root of the tree, which is a leaf when there is only one word. If this is nullptr, the tree is empty.
+
+	unsigned long long numberOfLeaves = 0;	// The number of leaves, which is the number of distinct words
+	unsigned long long numberOfNode4s = 0;	// The number of Node4s in the tree
+	unsigned long long numberOfNode16s = 0;	// The number of Node16s in the tree
+	unsigned long long numberOfNode48s = 0;	// The number of Node48s in the tree
+	unsigned long long numberOfNode256s = 0;	// The number of Node256s in the tree
+
+	DepthHistogram insertDepths; // How many nodes (inner nodes and the leaf, if we got to one) each insert went through
+	DepthHistogram lookupDepths; // How many nodes each find went through
+
+	statistic numberOfByteComparisons = 0;	// Keeps track of the number of key bytes compared against prefixes, leaves and child keys.
+	statistic numberOfNodesVisited = 0;		// Keeps track of the number of inner nodes passed through on the way down.
+	statistic numberOfLeafSplits = 0;		// Keeps track of the number of times a leaf was replaced by a Node4 holding it and a new word.
+	statistic numberOfPrefixSplits = 0;		// Keeps track of the number of times a compressed path was split by a new word.
+	statistic numberOfNodeGrowths = 0;		// Keeps track of the number of times a full node was replaced by a bigger one.
+};
@@ -29,8 +29,16 @@ AVL::AVL()
 AVL::~AVL()
 {
 	// On deconstruction, we have to delete the entire tree by
-	// deleting each node in the tree, one by one.
+	// deleting each node in the tree, one by one, as well as
+	// every node waiting on the free list.
 	//
+	while (freeList != nullptr) // While there are nodes on the free list,
+	{
+		node* del = freeList;			// we take the first one off,
+		freeList = freeList->leftChild;	// move the list along,
+		delete del;						// and delete it.
+	}
+
 	if (root == nullptr) // Check if the root node is null
 	{
 		return; // Return because there are no nodes to delete!
@@ -71,6 +79,47 @@ void AVL::traverseDestruct(node* p) {
 	delete p;
 }
 
+AVL::node* AVL::allocateNode()
+{
+	// This method hands out a node for insert to use. If a node was removed
+	// earlier, we take it off of the free list and reset it instead of asking
+	// the allocator for a new one.
+	//
+	if (freeList == nullptr)	// If there are no free nodes,
+	{
+		return new node();		// we have to make a new one.
+	}
+
+	node* p = freeList;				// Otherwise, we take the first free node,
+	freeList = freeList->leftChild;	// move the free list along,
+
+	// and reset the node back to its defaults, one field at a time, since a reader that was
+	// on it when it was removed might still be. Its word is left for insert to overwrite.
+	p->count = 1;
+	p->leftChild = p->rightChild = nullptr;
+	p->balanceFactor = 0;
+	p->size = 1;
+
+	return p;
+}
+
+void AVL::releaseNode(node* p)
+{
+	// This method puts a node that was removed from the tree at the front of the free list.
+	p->leftChild = freeList;
+	freeList = p;
+}
+
+unsigned int AVL::sizeOf(node* p)
+{
+	return p == nullptr ? 0 : p->size;
+}
+
+void AVL::updateSize(node* p)
+{
+	p->size = 1 + sizeOf(p->leftChild) + sizeOf(p->rightChild);
+}
+
 void AVL::insert(const char word[50])
 {
 	// To add a word to the tree, we need to traverse through the nodes of the tree,
@@ -80,8 +129,12 @@ void AVL::insert(const char word[50])
 	// the right child if the word is greater than the node's word we are traversing.
 	// If it is not found, we just make a new node and attach it to the tree. After
 	// we have inserted the node, we check if we have an unacceptable imbalance in the
-	// tree and fix it if needs be.
+	// tree and fix it if needs be. Every node on the way down gets one more node in
+	// its subtree, which we take care of once we know the word really is new.
 	//
+	SeqLock::writeSection write(seqLock); // Any readers on other threads have to know that we are changing the tree.
+
+	node* path[MAX_HEIGHT];	// The nodes we went through on the way down, so that we can count the new node in their subtree sizes
 	node* y;				// The new node we will be inserting
 	node* a, * b, * f;		// see below...
 	node* p, * q;			// ...
@@ -90,13 +143,14 @@ void AVL::insert(const char word[50])
 
 	if (root == nullptr)	// If the tree is empty, then we just need to make a root node and we're done!
 	{
-		y = new node();			// construct a root node
-		strcpy(y->word, word);	// copy the word we are inserting into y's word array
+		y = allocateNode();		// construct a root node
+		storeWord(y->word, word);	// copy the word we are inserting into y's word array
 		y->leftChild = y->rightChild = nullptr;	// since this new node is a leaf, it has no children
 		y->balanceFactor = 0; // a leaf has no children so it has to be balanced!
 		root = y; // root was null, so Y is the new root
 		numberOfReferenceChanges++;		// increment the number of reference changes since we changed the root
 		numberOfNoRotationsNeeded++;	// increment the number of no rotations needed since we didn't perform a rotation
+		insertDepths.record(0);			// and record that we didn't have to look at any nodes
 		return;
 	}
 
@@ -111,21 +165,33 @@ void AVL::insert(const char word[50])
 
 	// We define this to keep track of the compare value between our new node's word
 	// and p's word so that we can use it twice below to avoid a redundant strcmp call.
-	int compareValue;
+	int compareValue = 0;
+
+	size_t depth = 0; // The number of nodes we have compared our word against
 
 	while (p != nullptr) // lets search the tree for our insertion point
 	{
+		if (prefetching) // If we are prefetching, we start loading both children while we compare against p.
+		{
+			prefetchObject(p->leftChild.load());
+			prefetchObject(p->rightChild.load());
+		}
+
 		compareValue = strcmp(word, p->word); // compare the word we are inserting to p's word
 
 		numberOfKeyComparisonsMade++; // increment the number of key comparisons since we just made one
+		depth++;
 
 		if (compareValue == 0)	// if word equals p->word...
 		{
 			p->count++;			// increment p's count by one,
+			insertDepths.record(depth);
 
 			return;				// and return because we are done here!
 		}
 
+		path[depth - 1] = p; // We remember each node we pass, in case the word turns out to be new.
+
 		if (p->balanceFactor != 0)	// remember the last place we saw
 		{
 			a = p;					// a non-zero balance factor
@@ -138,11 +204,13 @@ void AVL::insert(const char word[50])
 		p = compareValue < 0 ? p->leftChild : p->rightChild;
 	}
 
+	insertDepths.record(depth); // We didn't find the word, so we record how far down we looked before adding it.
+
 	// At this point, p is nullptr, but q points at the last node where x
 	// belongs (either as q's left child or right child, and q points to an existing leaf)
 	//
-	y = new node();			// construct a new node,
-	strcpy(y->word, word);	// copy the word we are inserting into y's word array
+	y = allocateNode();		// construct a new node,
+	storeWord(y->word, word);	// copy the word we are inserting into y's word array
 	y->leftChild = y->rightChild = nullptr;	// since this new node is a leaf, it has no children
 	y->balanceFactor = 0; // a leaf has no children so it has to be balanced!
 
@@ -159,6 +227,11 @@ void AVL::insert(const char word[50])
 
 	numberOfReferenceChanges++;		// and increment the number of reference changes since we changed q's left or right child.
 
+	for (size_t i = 0; i < depth; i++) // Every node above y now has one more node in its subtree.
+	{
+		path[i]->size++;
+	}
+
 	// At this point, we have just done the same BST insert that we've done before. Now, we do the AVL
 	// specific operations to detect and fix an imbalance if we have one.
 
@@ -244,6 +317,9 @@ void AVL::insert(const char word[50])
 			a->balanceFactor = b->balanceFactor = 0;	// since nodes a and b are both balanced now, we set their balance factors to 0,
 			numberOfBalanceFactorChanges += 2;			// and increment the balance factor changes by two.
 
+			updateSize(a);	// a is now below b, so a's subtree size is worked out first,
+			updateSize(b);	// and then b's.
+
 			numberOfLeftLeftRotations++;				// since we've performed a left left rotation, we increment the count by one.
 		}
 		else // LR rotation: we have three different cases to handle in terms of the balance factors
@@ -289,6 +365,10 @@ void AVL::insert(const char word[50])
 				break;
 			}
 
+			updateSize(a);			// a and b are now below c, so their subtree sizes are worked out before c's.
+			updateSize(b);
+			updateSize(c);
+
 			b = c;					// b is the root of the now-rebalanced subtree.
 
 			numberOfLeftRightRotations++;		// since we've performed a left right rotation, we increment the count by one.
@@ -311,6 +391,9 @@ void AVL::insert(const char word[50])
 			a->balanceFactor = b->balanceFactor = 0;	// since nodes a and b are both balanced now, we set their balance factors to 0,
 			numberOfBalanceFactorChanges += 2;			// and increment the balance factor changes by two.
 
+			updateSize(a);	// a is now below b, so a's subtree size is worked out first,
+			updateSize(b);	// and then b's.
+
 			numberOfRightRightRotations++;				// since we've performed a left left rotation, we increment the count by one.
 		}
 		else // RL rotation: we have three different cases to handle in terms of the balance factors
@@ -354,6 +437,10 @@ void AVL::insert(const char word[50])
 				break;
 			}
 
+			updateSize(a);			// a and b are now below c, so their subtree sizes are worked out before c's.
+			updateSize(b);
+			updateSize(c);
+
 			b = c;					// b is the root of the now-rebalanced subtree.
 
 			numberOfRightLeftRotations++;		// since we've performed a right left rotation, we increment the count by one.
@@ -391,10 +478,334 @@ void AVL::insert(const char word[50])
 	cout << "We should never be here!\n";
 }
 
+AVL::node* AVL::search(const char word[50], node* path[MAX_HEIGHT], int direction[MAX_HEIGHT], int& depth)
+{
+	// This method looks for the node with the given word the same way insert does. Since
+	// our nodes don't have parent pointers, we remember every node on the way down in path,
+	// and which way we went at each one in direction, so that a removal can walk back up
+	// the tree to fix balance factors. We use +1 for left and -1 for right, which is the
+	// same sign convention as our balance factors and insert's displacement.
+	//
+	node* p = root; // We start at the root.
+	depth = 0;		// and haven't gone through any nodes yet.
+
+	while (p != nullptr) // as long as there are more nodes:
+	{
+		int compareValue = strcmp(word, p->word); // compare the word we are looking for to p's word
+
+		numberOfKeyComparisonsMade++; // increment the number of key comparisons since we just made one
+
+		if (compareValue == 0) // If the words are the same, we found it!
+		{
+			return p;
+		}
+
+		path[depth] = p;								// Otherwise, we remember p,
+		direction[depth] = compareValue < 0 ? +1 : -1;	// which way we are leaving it,
+		depth++;
+
+		p = compareValue < 0 ? p->leftChild : p->rightChild; // and go down that way.
+	}
+
+	return nullptr; // We fell off the bottom of the tree, so the word isn't here.
+}
+
+bool AVL::remove(const char word[50])
+{
+	// To remove a word, we find its node and unlink it from the tree,
+	// regardless of how many times the word was inserted.
+	//
+	SeqLock::writeSection write(seqLock); // Any readers on other threads have to know that we are changing the tree.
+
+	node* path[MAX_HEIGHT];
+	int direction[MAX_HEIGHT];
+	int depth;
+
+	node* p = search(word, path, direction, depth);
+
+	if (p == nullptr) // If the word isn't in the tree,
+	{
+		return false; // there is nothing to remove.
+	}
+
+	removeNode(p, path, direction, depth);
+
+	return true;
+}
+
+bool AVL::decrement(const char word[50])
+{
+	// To decrement a word, we find its node and lower its count by one. If the
+	// count would reach zero, the word is no longer in the set, so we remove it.
+	//
+	SeqLock::writeSection write(seqLock); // Any readers on other threads have to know that we are changing the tree.
+
+	node* path[MAX_HEIGHT];
+	int direction[MAX_HEIGHT];
+	int depth;
+
+	node* p = search(word, path, direction, depth);
+
+	if (p == nullptr) // If the word isn't in the tree,
+	{
+		return false; // there is nothing to decrement.
+	}
+
+	if (p->count > 1)	// If the word was inserted more than once,
+	{
+		p->count--;		// we just lower its count.
+	}
+	else
+	{
+		removeNode(p, path, direction, depth); // Otherwise, it is going away entirely.
+	}
+
+	return true;
+}
+
+void AVL::replaceChild(node* parent, int direction, node* child)
+{
+	// This method links child into the spot under parent on the side given
+	// by direction, or makes it the root if there is no parent.
+	//
+	if (parent == nullptr)
+	{
+		root = child;
+	}
+	else if (direction == +1)
+	{
+		parent->leftChild = child;
+	}
+	else
+	{
+		parent->rightChild = child;
+	}
+
+	numberOfReferenceChanges++; // Either way, we changed a reference.
+}
+
+void AVL::removeNode(node* p, node* path[MAX_HEIGHT], int direction[MAX_HEIGHT], int depth)
+{
+	// This method removes node p from the tree. The path array holds the nodes above
+	// p, and direction holds the side we went down at each of them. First, we do the
+	// same removal as a BST: a node with at most one child is replaced by that child,
+	// and a node with two children is replaced by its successor, which is spliced out
+	// of its old spot. Then we walk back up the path fixing balance factors, rotating
+	// wherever a subtree became unacceptably imbalanced.
+	//
+	int pIndex = depth; // The spot in the path where p's replacement will go if p has two children
+
+	if (p->leftChild != nullptr && p->rightChild != nullptr) // If p has two children, we need its successor.
+	{
+		path[depth] = p;		// The successor is down p's right subtree,
+		direction[depth] = -1;	// so we go right from p,
+		depth++;
+
+		node* s = p->rightChild;
+
+		while (s->leftChild != nullptr)	// and then as far left as we can.
+		{
+			path[depth] = s;
+			direction[depth] = +1;
+			depth++;
+			s = s->leftChild;
+		}
+
+		// The successor's right subtree takes the successor's old spot. The last node of the
+		// path is the successor's parent, which is either p itself or somewhere below it.
+		if (path[depth - 1] == p)
+		{
+			p->rightChild = s->rightChild;
+		}
+		else
+		{
+			path[depth - 1]->leftChild = s->rightChild;
+		}
+
+		s->leftChild = p->leftChild;			// The successor now takes over p's children
+		s->rightChild = p->rightChild;			//
+		s->balanceFactor = p->balanceFactor;	// and its balance factor and subtree size, since it takes p's place exactly.
+		s->size = p->size;
+		numberOfReferenceChanges += 3;			// We've changed three references.
+
+		replaceChild(pIndex > 0 ? path[pIndex - 1] : nullptr, pIndex > 0 ? direction[pIndex - 1] : 0, s); // p's parent now points to the successor,
+
+		path[pIndex] = s; // and the successor is now the node at p's spot in the path.
+	}
+	else
+	{
+		// With at most one child, that child (or nullptr) takes p's spot.
+		node* child = p->leftChild != nullptr ? p->leftChild : p->rightChild;
+
+		replaceChild(depth > 0 ? path[depth - 1] : nullptr, depth > 0 ? direction[depth - 1] : 0, child);
+	}
+
+	releaseNode(p);			// p is out of the tree, so it goes onto the free list.
+	numberOfDeletions++;	// We've deleted a node.
+
+	for (int i = 0; i < depth; i++) // Every node left on the path has one less node in its subtree. We do this
+	{								// first, since the rebalancing below can stop before it reaches the root.
+		path[i]->size--;
+	}
+
+	// Now we walk back up the path. At each node, the subtree on the side given by direction just got
+	// one shorter. As long as that makes the node's own subtree shorter, we have to keep going up.
+	for (int i = depth - 1; i >= 0; i--)
+	{
+		node* a = path[i];			// The node we are fixing,
+		int side = direction[i];	// and the side of it that got shorter.
+
+		if (a->balanceFactor == 0)	// If a was balanced, it is now slightly heavy on the other side,
+		{
+			a->balanceFactor = -side;
+			numberOfBalanceFactorChanges++;
+			return;					// but its height didn't change, so nothing above it changes either.
+		}
+
+		if (a->balanceFactor == side)	// If a was heavy on the side that got shorter, it is now balanced,
+		{
+			a->balanceFactor = 0;
+			numberOfBalanceFactorChanges++;
+			continue;					// but it got shorter, so we keep going up.
+		}
+
+		// Otherwise, a was already heavy on the other side, and now it is unacceptably imbalanced,
+		// so we rotate. b is a's child on the tall side. Unlike an insert, b can be balanced, in
+		// which case a single rotation fixes a without making the subtree any shorter.
+		node* b = side == +1 ? a->rightChild : a->leftChild;
+		node* newRoot;				// The root of the subtree after the rotation
+		bool shorter = true;		// Whether or not the rotation made the subtree shorter
+
+		if (side == +1) // The left side got shorter, so a is too heavy on the right.
+		{
+			if (b->balanceFactor != +1) // RR rotation
+			{
+				a->rightChild = b->leftChild;	// We set a's right child to be b's left child,
+				b->leftChild = a;				// and set b's left child to be a.
+
+				if (b->balanceFactor == 0)		// If b was balanced, a is still a little right heavy and b is a little left heavy.
+				{
+					a->balanceFactor = -1;
+					b->balanceFactor = +1;
+					shorter = false;
+				}
+				else							// Otherwise, both are balanced.
+				{
+					a->balanceFactor = b->balanceFactor = 0;
+				}
+
+				newRoot = b;
+				numberOfDeletionSingleRotations++;
+			}
+			else // RL rotation
+			{
+				node* c = b->leftChild;			// c is b's left child.
+
+				b->leftChild = c->rightChild;	// b takes c's right subtree,
+				a->rightChild = c->leftChild;	// a takes c's left subtree,
+				c->rightChild = b;				// and c becomes the parent of both.
+				c->leftChild = a;
+
+				switch (c->balanceFactor) // We adjust a and b's balance factors based on c's balance factor.
+				{
+				case 0:
+					a->balanceFactor = b->balanceFactor = 0;
+					break;
+				case 1:
+					a->balanceFactor = 0;
+					b->balanceFactor = -1;
+					break;
+				case -1:
+					a->balanceFactor = +1;
+					b->balanceFactor = 0;
+					break;
+				}
+
+				c->balanceFactor = 0;
+				newRoot = c;
+				numberOfReferenceChanges += 2; // A double rotation changes two more references than a single one.
+				numberOfDeletionDoubleRotations++;
+			}
+		}
+		else // The right side got shorter, so a is too heavy on the left. This is symmetrical to the case above.
+		{
+			if (b->balanceFactor != -1) // LL rotation
+			{
+				a->leftChild = b->rightChild;	// We set a's left child to be b's right child,
+				b->rightChild = a;				// and set b's right child to be a.
+
+				if (b->balanceFactor == 0)		// If b was balanced, a is still a little left heavy and b is a little right heavy.
+				{
+					a->balanceFactor = +1;
+					b->balanceFactor = -1;
+					shorter = false;
+				}
+				else							// Otherwise, both are balanced.
+				{
+					a->balanceFactor = b->balanceFactor = 0;
+				}
+
+				newRoot = b;
+				numberOfDeletionSingleRotations++;
+			}
+			else // LR rotation
+			{
+				node* c = b->rightChild;		// c is b's right child.
+
+				b->rightChild = c->leftChild;	// b takes c's left subtree,
+				a->leftChild = c->rightChild;	// a takes c's right subtree,
+				c->leftChild = b;				// and c becomes the parent of both.
+				c->rightChild = a;
+
+				switch (c->balanceFactor) // We adjust a and b's balance factors based on c's balance factor.
+				{
+				case 0:
+					a->balanceFactor = b->balanceFactor = 0;
+					break;
+				case 1:
+					a->balanceFactor = -1;
+					b->balanceFactor = 0;
+					break;
+				case -1:
+					a->balanceFactor = 0;
+					b->balanceFactor = +1;
+					break;
+				}
+
+				c->balanceFactor = 0;
+				newRoot = c;
+				numberOfReferenceChanges += 2; // A double rotation changes two more references than a single one.
+				numberOfDeletionDoubleRotations++;
+			}
+		}
+
+		updateSize(a); // a is below the new subtree root either way, so its size is worked out first.
+
+		if (newRoot != b)	// After a double rotation, b is below the new root as well.
+		{
+			updateSize(b);
+		}
+
+		updateSize(newRoot);
+
+		numberOfReferenceChanges += 2;		// Every rotation changes at least two references,
+		numberOfBalanceFactorChanges += 2;	// and at least two balance factors.
+
+		replaceChild(i > 0 ? path[i - 1] : nullptr, i > 0 ? direction[i - 1] : 0, newRoot); // The new subtree root takes a's spot.
+
+		if (!shorter) // If the rotation didn't make the subtree shorter,
+		{
+			return;   // nothing above it changes, so we are done.
+		}
+	}
+}
+
 void AVL::list()
 {
-	// This method traverses through the entire tree and prints out the nodes in a nicely formatted list
-	// with indexes and the node's word and count.
+	// This method prints out every word in the tree in a nicely formatted list with indexes and
+	// each node's word and count. We used to do this with a recursive traversal, which goes as
+	// deep as the tree does. Instead, we take the words a page at a time through nextPage, the
+	// same way any other listing would, which needs no recursion and only one page of memory.
 	//
 	if (root == nullptr) // If the root is nullptr, than there is nothing in the tree,
 	{
@@ -404,49 +815,445 @@ void AVL::list()
 	{
 		cout << "Set contains: "; // so we print out "Set contains: " as a prefix,
 
+		WordCursor cursor;				// We start at the first word,
+		WordEntry page[LIST_PAGE_SIZE];	// and take a page of words at a time.
+		size_t filled;
 		int index = 0; // We set up a index variable to 0 that is incremented before printing a node
 
-		list(index, root); // We now start our recursive traversal through the root node with our overloaded list method.
+		while ((filled = nextPage(cursor, page, LIST_PAGE_SIZE)) > 0)
+		{
+			for (size_t i = 0; i < filled; i++)
+			{
+				if (index != 0) // Every word after the first is separated from the one before it by a comma.
+				{
+					cout << ", ";
+				}
+
+				cout << "(" << ++index << ") " << page[i].word << " " << page[i].count;
+			}
+		}
 
-		cout << endl; // We finish off the output by printing out a newline, as we never did it inside the above method call.
+		cout << endl; // We finish off the output by printing out a newline.
 	}
 };
 
-void AVL::list(int& index, node* p)
+void AVL::merge(const AVL& other)
 {
-	// This method does a recursive traversal through all of the nodes in the tree
-	// and prints out their word and count with an index parameter. The index
-	// parameter is passed by reference so that no matter which recursive call
-	// of this method we are in, the correct index will always be printed out.
-	// Through talking with Dr. Thomas, I learned that the index variable could
-	// have been a class variable instead. I enjoy this method because it does
-	// not require any cleanup or setup of a class variable.
+	// This method adds every word of the other tree to this one, along with its count. Inserting
+	// the other tree's words one at a time would cost O(m log(n + m)) and a trip down the tree
+	// for each of them. Instead, we walk both trees in order at the same time, the way merge
+	// sort merges two sorted lists, and then relink the merged list of nodes into a perfectly
+	// balanced tree, so the whole merge takes O(n + m) time. Our own nodes are reused as they
+	// are (only their links change), so only the words that were just in the other tree are
+	// copied. The other tree isn't changed, unless it is this tree, in which case every count
+	// doubles (both iterators are on the same node every step, so it adds its count to itself).
 	//
-	if (p->leftChild != nullptr)   // If the left child of the node is not null,
+	SeqLock::writeSection write(seqLock); // Any readers on other threads have to know that we are changing the tree.
+
+	vector<node*> merged;	// Every node of the merged tree, in alphabetical order
+	iterator mine = lowerBound(nullptr, WordBound());			// Our next word
+	iterator theirs = other.lowerBound(nullptr, WordBound());	// The other tree's next word
+	iterator end;
+
+	while (mine != end || theirs != end) // Until both trees run out,
 	{
-		list(index, p->leftChild); // we print out the left child node as well, recursively taking care of its children.
+		int compareValue; // Less than zero if our word comes first, greater than zero if theirs does
+
+		if (mine == end)
+		{
+			compareValue = 1;
+		}
+		else if (theirs == end)
+		{
+			compareValue = -1;
+		}
+		else
+		{
+			compareValue = strcmp(mine.current()->word, theirs.current()->word);
+			numberOfKeyComparisonsMade++;
+		}
+
+		if (compareValue <= 0) // If our word comes first (or both trees have it), we keep our node,
+		{
+			node* p = mine.current();
+
+			if (compareValue == 0) // adding the other tree's count to ours if it has the word too.
+			{
+				p->count += theirs.current()->count;
+				++theirs;
+			}
+
+			merged.push_back(p);
+			++mine;
+		}
+		else // If their word comes first, it needs a node of its own.
+		{
+			node* p = allocateNode();
 
-		// Since we have now printed out the left child node, we need to print
-		// out a comma to separate it from the node we are about to print.
-		//
-		cout << ", ";
+			storeWord(p->word, theirs.current()->word);
+			p->count = theirs.current()->count;
+
+			merged.push_back(p);
+			++theirs;
+		}
 	}
 
-	// We now print out the index AFTER incrementing it, as well as the node's
-	// word and count.
-	cout << "(" << ++index << ") " << p->word << " " << p->count;
+	int height;
 
-	if (p->rightChild != nullptr) // If the right child of the node is not null,
+	root = buildBalanced(merged, 0, merged.size(), height); // We link the nodes up again, balanced.
+	numberOfReferenceChanges++;
+}
+
+AVL::node* AVL::buildBalanced(vector<node*>& nodes, size_t first, size_t last, int& height)
+{
+	// This method links nodes[first] to nodes[last - 1], which are in alphabetical order, into
+	// a perfectly balanced subtree and returns its root, setting height to its height. The middle
+	// node is the root, and the nodes on each side of it make up its subtrees. The left side gets
+	// the extra node when there is one, so the two halves never differ in size by more than one,
+	// which means their heights never do either and every balance factor is 0 or +1. The
+	// recursion is only as deep as the tree is tall.
+	//
+	if (first == last) // An empty range is an empty subtree.
+	{
+		height = 0;
+
+		return nullptr;
+	}
+
+	size_t middle = first + (last - first) / 2;
+	node* p = nodes[middle];
+	int leftHeight;
+	int rightHeight;
+
+	p->leftChild = buildBalanced(nodes, first, middle, leftHeight);
+	p->rightChild = buildBalanced(nodes, middle + 1, last, rightHeight);
+	p->balanceFactor = leftHeight - rightHeight;
+	updateSize(p);
+	numberOfReferenceChanges += 2;
+
+	height = 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+
+	return p;
+}
+
+AVL::iterator AVL::lowerBound(const char* lo, const WordBound& bound) const
+{
+	// This method finds the first word in the tree that isn't less than lo. Since we
+	// don't have parent pointers, we remember every node we go left of on our way down,
+	// since those are exactly the nodes that come after the one we stop on. Queries
+	// don't count toward our insert statistics.
+	//
+	iterator it;		// The iterator we are building,
+	it.bound = bound;	// which stops at the given bound.
+
+	node* p = root; // We start our search at the root.
+
+	while (p != nullptr) // While we haven't fallen off the bottom of the tree,
+	{
+		if (lo == nullptr || strcmp(p->word, lo) >= 0) // if p's word isn't less than lo, p might be our answer,
+		{
+			it.stack.push_back(p);	// so we remember it,
+			p = p->leftChild;		// and look for a smaller answer to its left.
+		}
+		else						// Otherwise, p's word is too small,
+		{
+			p = p->rightChild;		// so the answer has to be to its right.
+		}
+	}
+
+	if (!it.stack.empty() && !bound.admits(it.stack.back()->word)) // If the first word is already past the bound,
+	{
+		it.stack.clear(); // our iterator starts at the end.
+	}
+
+	return it;
+}
+
+WordRange<AVL::iterator> AVL::words() const
+{
+	// Every word in the tree is the range starting at the smallest word with no bound.
+	return WordRange<iterator>(lowerBound(nullptr, WordBound()), iterator());
+}
+
+WordRange<AVL::iterator> AVL::rangeQuery(const char* lo, const char* hi) const
+{
+	// A range query starts at the first word not less than lo and stops after hi.
+	return WordRange<iterator>(lowerBound(lo, WordBound(WordBound::UPPER_BOUND, hi)), iterator());
+}
+
+WordRange<AVL::iterator> AVL::prefixQuery(const char* prefix) const
+{
+	// Every word that starts with the prefix is at least as big as the prefix itself,
+	// so we start there and stop at the first word that doesn't start with it.
+	return WordRange<iterator>(lowerBound(prefix, WordBound(WordBound::PREFIX, prefix)), iterator());
+}
+
+vector<WordCount> AVL::topK(size_t k) const
+{
+	// We find the top k words with a single pass over every word in the tree.
+	return selectTopK(words(), k);
+}
+
+size_t AVL::nextPage(WordCursor& cursor, WordEntry* buffer, size_t capacity) const
+{
+	// The page starts at the first word that isn't less than the cursor's last word, which we
+	// find the same way a range query does, and fillPage skips that word if it is still here.
+	return fillPage(lowerBound(cursor.started ? cursor.last : nullptr, WordBound()), iterator(), cursor, buffer, capacity);
+}
+
+unsigned int AVL::concurrentFind(const char word[50], unsigned long long* retries) const
+{
+	// This method searches for the word without a lock, checking with the sequence lock
+	// afterwards that the writer didn't change anything while we were looking. If it did, the
+	// count we found might be from a node that was moving (or was being reused for another
+	// word), so we look again.
+	//
+	while (true)
+	{
+		unsigned long long sequence = seqLock.beginRead();
+		node* p = root;
+		unsigned int count = 0;
+		int steps = 0; // The number of nodes we have gone through, in case the writer sent us around in circles
+
+		while (p != nullptr && steps++ < OPTIMISTIC_STEP_LIMIT)
+		{
+			int compareValue = compareWord(word, p->word);
+
+			if (compareValue == 0)
+			{
+				count = p->count;
+
+				break;
+			}
+
+			p = compareValue < 0 ? p->leftChild : p->rightChild;
+		}
+
+		if (seqLock.endRead(sequence)) // If nothing changed while we looked, what we found is right.
+		{
+			return count;
+		}
+
+		if (retries != nullptr)
+		{
+			(*retries)++;
+		}
+	}
+}
+
+size_t AVL::concurrentNextPage(WordCursor& cursor, WordEntry* buffer, size_t capacity, unsigned long long* retries) const
+{
+	// This method copies out a page the same way the iterators walk the tree, remembering the
+	// nodes we go left of on a stack, but without a lock. The cursor is only moved along once
+	// the sequence lock says the whole page was copied while nothing changed. Otherwise the
+	// page might be missing words or have some twice, so we copy it again.
+	//
+	vector<node*> stack;
+
+	while (true)
+	{
+		unsigned long long sequence = seqLock.beginRead();
+		size_t filled = 0;
+		int steps = 0; // The number of nodes we have gone through on one trip down the tree
+
+		stack.clear();
+
+		for (node* p = root; p != nullptr && steps++ < OPTIMISTIC_STEP_LIMIT; ) // We go down to the first word after the cursor's word,
+		{
+			if (!cursor.started || compareWord(cursor.last, p->word) < 0)
+			{
+				stack.push_back(p);
+				p = p->leftChild;
+			}
+			else
+			{
+				p = p->rightChild;
+			}
+		}
+
+		while (!stack.empty() && filled < capacity) // and copy words out in order from there.
+		{
+			node* p = stack.back();
+			stack.pop_back();
+
+			loadWord(buffer[filled].word, p->word);
+			buffer[filled].count = p->count;
+			filled++;
+
+			steps = 0;
+
+			for (node* q = p->rightChild; q != nullptr && steps++ < OPTIMISTIC_STEP_LIMIT; q = q->leftChild)
+			{
+				stack.push_back(q);
+			}
+		}
+
+		if (seqLock.endRead(sequence)) // If nothing changed while we copied, the page is good.
+		{
+			if (filled > 0)
+			{
+				strcpy(cursor.last, buffer[filled - 1].word);
+				cursor.started = true;
+			}
+
+			cursor.finished = stack.empty();
+
+			return filled;
+		}
+
+		if (retries != nullptr)
+		{
+			(*retries)++;
+		}
+	}
+}
+
+size_t AVL::rank(const char word[50]) const
+{
+	// This method counts the words before the given word on a single trip down the tree.
+	// Whenever we go right of a node, the node and its whole left subtree come before the
+	// word, and the left subtree's size is stored in its root, so we never have to visit
+	// it. Like the other queries, this doesn't count toward our insert statistics.
+	//
+	size_t before = 0;	// The number of words we know come before the given word
+	node* p = root;
+
+	while (p != nullptr)
 	{
-		// we print out a comma to separate the node we already printed from
-		// the right child we are about to print.
-		cout << ", ";
+		int compareValue = strcmp(word, p->word);
+
+		if (compareValue <= 0) // Everything at and to the right of p comes after the word (or is the word),
+		{
+			if (compareValue == 0)	// and if p is the word, its left subtree is all that comes before it.
+			{
+				return before + sizeOf(p->leftChild);
+			}
 
-		list(index, p->rightChild); // we now print out the right child node as well, recursively taking care of its children.
+			p = p->leftChild;
+		}
+		else // Otherwise, p and everything to its left come before the word.
+		{
+			before += sizeOf(p->leftChild) + 1;
+			p = p->rightChild;
+		}
 	}
+
+	return before;
 }
 
-void AVL::calculateNumWords(unsigned int& numWords, unsigned int& numUniqueWords)
+WordCount AVL::select(size_t index) const
+{
+	// This method finds the word at the given index by comparing the index with the size
+	// of each node's left subtree on the way down: if the index is smaller, the word is to
+	// the left, if it is the same, it is this node, and otherwise it is to the right, where
+	// we look for the index minus the words we skipped over.
+	//
+	node* p = root;
+
+	while (p != nullptr)
+	{
+		size_t leftSize = sizeOf(p->leftChild);
+
+		if (index < leftSize)
+		{
+			p = p->leftChild;
+		}
+		else if (index == leftSize)
+		{
+			return { p->word, p->count };
+		}
+		else
+		{
+			index -= leftSize + 1;
+			p = p->rightChild;
+		}
+	}
+
+	return { nullptr, 0 }; // We fell off the bottom, so the tree doesn't have that many words.
+}
+
+WordRange<AVL::iterator> AVL::page(size_t index, size_t count) const
+{
+	// A page is a range query from the word at its first index to the word at its last one.
+	// If the page starts past the last word (or is empty), it has nothing in it. If it runs
+	// past the last word, it just stops there.
+	//
+	WordCount first = select(index);
+
+	if (first.word == nullptr || count == 0)
+	{
+		return WordRange<iterator>(iterator(), iterator());
+	}
+
+	// The first word is there, so index is less than the number of words, and we can compare
+	// count to the words left from index on without index + count ever overflowing.
+	size_t size = root->size;
+	size_t lastIndex = count > size - index ? size - 1 : index + count - 1;
+	WordCount last = select(lastIndex);
+
+	return WordRange<iterator>(lowerBound(first.word, WordBound(WordBound::UPPER_BOUND, last.word)), iterator());
+}
+
+FrozenTree* AVL::freeze() const
+{
+	// Our in-order traversal hands the words over already sorted, which is all a frozen tree needs.
+	//
+	vector<WordCount> sortedWords;
+
+	for (WordCount w : words())
+	{
+		sortedWords.push_back(w);
+	}
+
+	return new FrozenTree(sortedWords);
+}
+
+WordCount AVL::iterator::operator*() const
+{
+	return { stack.back()->word, stack.back()->count }; // The current node is on top of the stack.
+}
+
+AVL::iterator& AVL::iterator::operator++()
+{
+	// To move on to the next word, we pop the current node off of the stack. If it has
+	// a right subtree, the next word is the smallest word in that subtree, so we push
+	// the path down to it. Otherwise, the next word is the node we went left of most
+	// recently, which is already on top of the stack.
+	//
+	node* p = stack.back()->rightChild; // We will walk down the current node's right subtree,
+
+	stack.pop_back(); // after we are done with the current node.
+
+	while (p != nullptr)		// While there are more nodes on the way down,
+	{
+		stack.push_back(p);		// we remember each one,
+		p = p->leftChild;		// and keep going left to reach the smallest word.
+	}
+
+	if (!stack.empty() && !bound.admits(stack.back()->word)) // If we've gone past the bound,
+	{
+		stack.clear(); // we are at the end.
+	}
+
+	return *this;
+}
+
+bool AVL::iterator::operator==(const iterator& other) const
+{
+	return current() == other.current();
+}
+
+bool AVL::iterator::operator!=(const iterator& other) const
+{
+	return current() != other.current();
+}
+
+AVL::node* AVL::iterator::current() const
+{
+	return stack.empty() ? nullptr : stack.back(); // An empty stack means we are at the end.
+}
+
+void AVL::calculateNumWords(unsigned long long& numWords, unsigned long long& numUniqueWords)
 {
 	// This method calculates the number of words and unique words in the tree.
 	// The method takes two unsigned integer references that it initializes to zero.
@@ -456,10 +1263,13 @@ void AVL::calculateNumWords(unsigned int& numWords, unsigned int& numUniqueWords
 	numWords = 0;
 	numUniqueWords = 0;
 
-	calculateNumWords(root, numWords, numUniqueWords); // We call the calculation method at the root node so we can count the whole tree.
+	if (root != nullptr) // If the tree isn't empty,
+	{
+		calculateNumWords(root, numWords, numUniqueWords); // we call the calculation method at the root node so we can count the whole tree.
+	}
 }
 
-void AVL::calculateNumWords(node* p, unsigned int& numWords, unsigned int& numUniqueWords)
+void AVL::calculateNumWords(node* p, unsigned long long& numWords, unsigned long long& numUniqueWords)
 {
 	// This method does a recursive traversal through all of the nodes in the tree
 	// and increments the references to the number of words and unique words through
@@ -525,20 +1335,340 @@ void AVL::calculateHeight(node* p, unsigned int& height, unsigned int traversalH
 	}
 }
 
+unsigned int AVL::find(const char word[50])
+{
+	// This method walks down the tree looking for the word, just like insert does, but
+	// it doesn't change anything. Lookups don't count toward our insert statistics.
+	//
+	node* p = root;
+	size_t depth = 0; // The number of nodes we have compared our word against
+
+	while (p != nullptr) // While there are more nodes to look at,
+	{
+		if (prefetching) // we start loading both children if we are prefetching,
+		{
+			prefetchObject(p->leftChild.load());
+			prefetchObject(p->rightChild.load());
+		}
+
+		int compareValue = strcmp(word, p->word); // compare our word to p's word,
+
+		depth++;
+
+		if (compareValue == 0) // and if they are the same, we found it!
+		{
+			lookupDepths.record(depth);
+
+			return p->count;
+		}
+
+		p = compareValue < 0 ? p->leftChild : p->rightChild; // Otherwise, we go down the side the word has to be on.
+	}
+
+	lookupDepths.record(depth);
+
+	return 0; // We fell off of the tree, so the word isn't in it.
+}
+
+unsigned int AVL::depthOf(const char* word) const
+{
+	// This method walks down the tree like find does, but only keeps track of how deep it is.
+	//
+	node* p = root;
+	unsigned int depth = 1;
+
+	while (p != nullptr)
+	{
+		int compareValue = strcmp(word, p->word);
+
+		if (compareValue == 0)
+		{
+			return depth;
+		}
+
+		p = compareValue < 0 ? p->leftChild : p->rightChild;
+		depth++;
+	}
+
+	return 0;
+}
+
+void AVL::findBatch(const char* const words[], size_t numberOfWords, unsigned int counts[])
+{
+	// This method looks up a whole array of words. Without prefetching, we just call find on
+	// each one. With prefetching, we look words up PREFETCH_GROUP_SIZE at a time, taking one
+	// step down the tree for each lookup in the group in turn. After each step, we prefetch
+	// the node that lookup will compare against next, and by the time we come back around to
+	// it, the node should be in the cache. This way, the lookups in a group wait on memory
+	// at the same time instead of one after another.
+	//
+	if (!prefetching)
+	{
+		for (size_t i = 0; i < numberOfWords; i++)
+		{
+			counts[i] = find(words[i]);
+		}
+
+		return;
+	}
+
+	for (size_t start = 0; start < numberOfWords; start += PREFETCH_GROUP_SIZE) // For each group of words,
+	{
+		size_t groupSize = numberOfWords - start < PREFETCH_GROUP_SIZE ? numberOfWords - start : PREFETCH_GROUP_SIZE;
+		node* cursors[PREFETCH_GROUP_SIZE];	// The node each lookup in the group is on, or nullptr once it is done
+		size_t depths[PREFETCH_GROUP_SIZE];	// The number of nodes each lookup in the group has compared against
+		size_t active = 0;					// The number of lookups in the group that aren't done yet
+
+		for (size_t i = 0; i < groupSize; i++) // every lookup starts at the root.
+		{
+			cursors[i] = root;
+			counts[start + i] = 0;
+			depths[i] = 0;
+
+			if (root != nullptr)
+			{
+				active++;
+			}
+		}
+
+		while (active > 0) // While any lookup in the group isn't done,
+		{
+			for (size_t i = 0; i < groupSize; i++) // we take one step with each lookup.
+			{
+				node* p = cursors[i];
+
+				if (p == nullptr) // This lookup is already done.
+				{
+					continue;
+				}
+
+				int compareValue = strcmp(words[start + i], p->word);
+
+				depths[i]++;
+
+				if (compareValue == 0) // If we found the word, we have its count and this lookup is done.
+				{
+					counts[start + i] = p->count;
+					p = nullptr;
+				}
+				else
+				{
+					p = compareValue < 0 ? p->leftChild : p->rightChild;
+				}
+
+				if (p == nullptr)
+				{
+					lookupDepths.record(depths[i]);
+					active--;
+				}
+				else
+				{
+					prefetchObject(p); // We start loading the next node now, and come back to it after the rest of the group.
+				}
+
+				cursors[i] = p;
+			}
+		}
+	}
+}
+
+void AVL::setPrefetching(bool enabled)
+{
+	prefetching = enabled;
+}
+
+const DepthHistogram& AVL::getLookupDepths() const
+{
+	return lookupDepths;
+}
+
+bool AVL::validate() const
+{
+	// Besides the order, every node's balance factor has to be the height of its left subtree
+	// minus the height of its right subtree, and that can't be more than one either way. We work
+	// the heights out bottom up with our own stacks: each node goes on the stack once to push
+	// its children and once more, after both of them are done, to check itself. By then, the
+	// heights of its left and right subtrees are the top two entries of heights.
+	//
+	const char* previous = nullptr; // The word before the one we are on, in alphabetical order
+
+	for (WordCount w : words()) // An in-order walk has to see the words in strictly increasing order,
+	{
+		if (previous != nullptr && strcmp(previous, w.word) >= 0)
+		{
+			cout << "AVL is invalid: \"" << w.word << "\" comes after \"" << previous << "\"\n";
+
+			return false;
+		}
+
+		if (w.count == 0) // and every word in the tree has to have been inserted at least once.
+		{
+			cout << "AVL is invalid: \"" << w.word << "\" has a count of zero\n";
+
+			return false;
+		}
+
+		previous = w.word;
+	}
+
+	vector<pair<node*, bool>> stack;	// The nodes to visit, and whether their children are done yet
+	vector<int> heights;				// The heights of the subtrees we have finished, in the order we finished them
+
+	stack.push_back(make_pair(root, false));
+
+	while (!stack.empty())
+	{
+		node* p = stack.back().first;
+		bool childrenDone = stack.back().second;
+
+		stack.pop_back();
+
+		if (p == nullptr) // An empty subtree has a height of zero.
+		{
+			heights.push_back(0);
+
+			continue;
+		}
+
+		if (!childrenDone) // The first time we see a node, we come back to it after its children,
+		{
+			stack.push_back(make_pair(p, true));
+			stack.push_back(make_pair(p->rightChild, false));	// which are pushed right first so that
+			stack.push_back(make_pair(p->leftChild, false));	// the left one finishes first.
+
+			continue;
+		}
+
+		int rightHeight = heights.back();
+		heights.pop_back();
+		int leftHeight = heights.back();
+		heights.pop_back();
+
+		if (p->balanceFactor != leftHeight - rightHeight)
+		{
+			cout << "AVL is invalid: \"" << p->word << "\" has a balance factor of " << p->balanceFactor
+				<< " but its subtrees' heights are " << leftHeight << " and " << rightHeight << "\n";
+
+			return false;
+		}
+
+		if (p->size != 1 + sizeOf(p->leftChild) + sizeOf(p->rightChild)) // Each subtree size has to add up as well.
+		{
+			cout << "AVL is invalid: \"" << p->word << "\" has a subtree size of " << p->size << " but "
+				<< sizeOf(p->leftChild) << " nodes on its left and " << sizeOf(p->rightChild) << " on its right\n";
+
+			return false;
+		}
+
+		if (p->balanceFactor < -1 || p->balanceFactor > 1)
+		{
+			cout << "AVL is invalid: \"" << p->word << "\" is out of balance by " << p->balanceFactor << "\n";
+
+			return false;
+		}
+
+		heights.push_back(1 + (leftHeight > rightHeight ? leftHeight : rightHeight));
+	}
+
+	return true;
+}
+
+unsigned long long AVL::getKeyComparisons()
+{
+	return numberOfKeyComparisonsMade;
+}
+
+unsigned long long AVL::getReferenceChanges()
+{
+	return numberOfReferenceChanges;
+}
+
+unsigned long long AVL::getMemoryUsage()
+{
+	// This method returns the number of bytes the nodes of the tree take up. Every distinct
+	// word has a node, so this is just the number of nodes times the size of a node.
+	//
+	unsigned long long numWords, numUniqueWords;
+
+	calculateNumWords(numWords, numUniqueWords);
+
+	return numUniqueWords * sizeof(node);
+}
+
+unsigned long long AVL::getAllocatedBytes()
+{
+	// This method adds up how big the allocator says each node's block really is, which
+	// includes whatever the allocator rounded the node's size up by. We visit every node
+	// with our own stack of nodes, the same way the iterators do.
+	//
+	unsigned long long bytes = 0;
+	vector<node*> stack;
+
+	if (root != nullptr)
+	{
+		stack.push_back(root);
+	}
+
+	while (!stack.empty()) // While there are still nodes to visit,
+	{
+		node* p = stack.back(); // we take one off of the stack,
+		stack.pop_back();
+
+		bytes += MemoryUsage::allocatedSize(p); // count its block,
+
+		if (p->leftChild != nullptr) // and push its children to visit later.
+		{
+			stack.push_back(p->leftChild);
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(p->rightChild);
+		}
+	}
+
+	return bytes + getFreeListBytes(); // The removed nodes on the free list are still ours too.
+}
+
+unsigned long long AVL::getFreeListBytes()
+{
+	// This method adds up the blocks of the removed nodes waiting on the free list. They
+	// aren't part of the tree anymore, but the allocator hasn't gotten them back either.
+	//
+	unsigned long long bytes = 0;
+
+	for (node* p = freeList; p != nullptr; p = p->leftChild)
+	{
+		bytes += MemoryUsage::allocatedSize(p);
+	}
+
+	return bytes;
+}
+
 void AVL::displayStatistics()
 {
 	// This method displays statistics related to the number of words in the tree and
 	// insertion statistics as nodes are inserted into the AVL tree.
 	//
-	unsigned int numWords, numUniqueWords; // Declare variables for the total number of words and unique words in the tree
+	unsigned long long numWords, numUniqueWords; // Declare variables for the total number of words and unique words in the tree
 
 	// Call the calculateNumWords, passing in our word counts by reference so that they are set to the proper values
 	calculateNumWords(numWords, numUniqueWords);
 
+	unsigned long long liveBytes = getMemoryUsage(); // We also find out how much memory the nodes take up,
+	unsigned long long allocatedBytes = getAllocatedBytes(); // and how much the allocator really set aside for them.
+	unsigned long long freeListBytes = getFreeListBytes(); // Some of that may be removed nodes waiting on the free list.
+
 	cout << "AVL Stats:\n"; // Print out a header specifying that these are AVL stats
 	cout << "Distinct Words: " << numUniqueWords << "\n"; // Print out the total number of unique words
 	cout << "Total Words: " << numWords << "\n"; // Print out the total number of words
 	cout << "Height: " << getHeight() << "\n"; // Print out the height of the tree
+	cout << "Node Size: " << sizeof(node) << " bytes\n"; // Print out how big a single node is
+	cout << "Live Bytes: " << liveBytes << "\n"; // Print out the number of bytes the nodes take up
+	cout << "Allocated Bytes: " << allocatedBytes << "\n"; // Print out the number of bytes the allocator set aside for them
+	cout << "Free List Bytes: " << freeListBytes << "\n"; // Print out how much of that is removed nodes waiting to be reused
+	cout << "Allocator Overhead: " << (allocatedBytes > liveBytes + freeListBytes ? allocatedBytes - liveBytes - freeListBytes : 0) << " bytes\n"; // Print out how much of the rest is rounding
+	cout << "Bytes per Distinct Word: " << (numUniqueWords > 0 ? (double)allocatedBytes / numUniqueWords : 0) << "\n"; // Print out what each distinct word costs
 	cout << "Reference Changes: " << numberOfReferenceChanges << "\n"; // Print out the total number of reference changes made
 	cout << "Balance Factor Changes: " << numberOfBalanceFactorChanges << "\n"; // Print out the total number of balance factor changes
 	cout << "A to Y Balance Factor Changes: " << numberOfAToYBalanceFactorChanges << "\n"; // Print out the total number of A to Y balance factor changes
@@ -549,4 +1679,11 @@ void AVL::displayStatistics()
 	cout << "RR Rotations: " << numberOfRightRightRotations << "\n";	// Print out the total number of right right rotations made
 	cout << "RL Rotations: " << numberOfRightLeftRotations << "\n";		// Print out the total number of right left rotations made
 	cout << "No Rotations Needed: " << numberOfNoRotationsNeeded << "\n"; // Print out the total number of insertions without any rotations needed
+	cout << "Deletions: " << numberOfDeletions << "\n"; // Print out the total number of nodes removed
+	cout << "Deletion Single Rotations: " << numberOfDeletionSingleRotations << "\n"; // Print out the number of LL and RR rotations made after deletions
+	cout << "Deletion Double Rotations: " << numberOfDeletionDoubleRotations << "\n"; // Print out the number of LR and RL rotations made after deletions
+	insertDepths.display("Insert Depths"); // Print out how many nodes each insert looked at
+
+	// Print out where the ten most frequent words are, which is where most of the inserts went.
+	displayWordDepths("Top Word Depths", topK(10), [this](const char* word) { return depthOf(word); });
 }
\ No newline at end of file
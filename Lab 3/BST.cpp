@@ -27,8 +27,16 @@ BST::BST()
 BST::~BST()
 {
 	// On deconstruction, we have to delete the entire tree by
-	// deleting each node in the tree, one by one.
+	// deleting each node in the tree, one by one, as well as
+	// every node waiting on the free list.
 	//
+	while (freeList != nullptr) // While there are nodes on the free list,
+	{
+		node* del = freeList;			// we take the first one off,
+		freeList = freeList->leftChild;	// move the list along,
+		delete del;						// and delete it.
+	}
+
 	if (root == nullptr) // Check if the root node is null
 	{
 		return; // Return because there are no nodes to delete!
@@ -47,26 +55,59 @@ BST::~BST()
 }
 
 void BST::traverseDestruct(node* p) {
-	// This recursive method can be called on a given node to delete
-	// its children and itself. Doing this recursively ensures that
-	// every node will get deleted as long as this method is initially
-	// called on the root node.
+	// This method can be called on a given node to delete its children and
+	// itself. A BST built from sorted input is as deep as it has nodes, so
+	// recursing down it would run out of stack. Instead, we keep the nodes we
+	// still have to visit on a stack of our own. Since a node's children are
+	// pushed before it is deleted, it doesn't matter what order we delete in.
 	//
-	if (p->leftChild != nullptr) // Check if the left child of the node is not null
+	vector<node*> stack; // The nodes we still have to delete
+
+	stack.push_back(p);
+
+	while (!stack.empty()) // While there are still nodes to delete,
 	{
-		traverseDestruct(p->leftChild); // Since the node does have a left child, we will call the traverseDestruct method on the node
+		p = stack.back(); // we take one off of the stack,
+		stack.pop_back();
+
+		if (p->leftChild != nullptr) // push its children so we don't lose them,
+		{
+			stack.push_back(p->leftChild);
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(p->rightChild);
+		}
+
+		delete p; // and delete it.
 	}
+}
 
-	if (p->rightChild != nullptr) // Check if the right child is not null
+BST::node* BST::allocateNode()
+{
+	// This method hands out a node for insert to use. If a node was removed
+	// earlier, we take it off of the free list and reset it instead of asking
+	// the allocator for a new one.
+	//
+	if (freeList == nullptr)	// If there are no free nodes,
 	{
-		traverseDestruct(p->rightChild); // Since the node does have a right child, we will call the traverseDestruct method on the node
+		return new node();		// we have to make a new one.
 	}
 
-	// Now that we have properly deleted the children of the given node,
-	// we are safe to delete the node since we have already taken care of
-	// its children.
-	//
-	delete p;
+	node* p = freeList;				// Otherwise, we take the first free node,
+	freeList = freeList->leftChild;	// move the free list along,
+
+	*p = node();					// and reset the node back to its defaults.
+
+	return p;
+}
+
+void BST::releaseNode(node* p)
+{
+	// This method puts a node that was removed from the tree at the front of the free list.
+	p->leftChild = freeList;
+	freeList = p;
 }
 
 void BST::insert(const char word[50])
@@ -85,13 +126,22 @@ void BST::insert(const char word[50])
 	// and p's word so that we can use it twice below to avoid a redundant strcmp call.
 	int compareValue;
 
+	size_t depth = 0; // The number of nodes we have compared our word against
+
 	while (p != nullptr) // as long as there are more nodes:
 	{
 		q = p; // Set our lagging pointer to q
 
+		if (prefetching) // If we are prefetching, we start loading both children while we compare against p.
+		{
+			prefetchObject(p->leftChild);
+			prefetchObject(p->rightChild);
+		}
+
 		compareValue = strcmp(word, p->word); // Compare the word we are inserting to p's word
 
 		numberOfKeyComparisonsMade++; // Increment our number of key comparisons as we just made one
+		depth++;
 
 		if (compareValue < 0) // Check if the word we are inserting is less than p's word
 		{
@@ -104,16 +154,19 @@ void BST::insert(const char word[50])
 		else // Since the word was not less than or greater than p's word, there is only one case remaining - it equals p's word
 		{
 			p->count++; // Since a node with the word already exists, we just increment the node's count by one.
+			insertDepths.record(depth);
 
 			return; // Since we don't need to insert any new nodes into the tree, we can just stop here. We are done!
 		}
 	}
 
+	insertDepths.record(depth); // We didn't find the word, so we record how far down we looked before adding it.
+
 	// Since we've gotten here, we weren't able to find a node
 	// with the word already in the tree, so lets build a new
 	// node to store the word.
 	//
-	node* newNode = new node(); // Construct a new node
+	node* newNode = allocateNode(); // Get a new node
 
 	strcpy(newNode->word, word); // Copy the contents of the word array we are inserting into the new node's word array
 	newNode->count = 1; // Redundantly set the count in the new node to 1
@@ -141,10 +194,138 @@ void BST::insert(const char word[50])
 	numberOfReferenceChanges++; // We have changed a single reference above so we increment our reference change coutner
 }
 
+BST::node* BST::search(const char word[50], node*& parent)
+{
+	// This method looks for the node with the given word the same way insert does,
+	// keeping track of the node's parent so that the node can be unlinked. If the
+	// word isn't in the tree, we return nullptr.
+	//
+	node* p = root;		// traverses the tree, starting at the root node
+	parent = nullptr;	// lags one step behind p
+
+	while (p != nullptr) // as long as there are more nodes:
+	{
+		int compareValue = strcmp(word, p->word); // Compare the word we are looking for to p's word
+
+		numberOfKeyComparisonsMade++; // Increment our number of key comparisons as we just made one
+
+		if (compareValue == 0) // If the words are the same, we found it!
+		{
+			return p;
+		}
+
+		parent = p; // Otherwise, we move our lagging pointer down to p,
+
+		p = compareValue < 0 ? p->leftChild : p->rightChild; // and p to the side of p that the word has to be on.
+	}
+
+	return nullptr; // We fell off the bottom of the tree, so the word isn't here.
+}
+
+bool BST::remove(const char word[50])
+{
+	// To remove a word, we find its node and unlink it from the tree,
+	// regardless of how many times the word was inserted.
+	//
+	node* parent;
+	node* p = search(word, parent);
+
+	if (p == nullptr) // If the word isn't in the tree,
+	{
+		return false; // there is nothing to remove.
+	}
+
+	removeNode(p, parent);
+
+	return true;
+}
+
+bool BST::decrement(const char word[50])
+{
+	// To decrement a word, we find its node and lower its count by one. If the
+	// count would reach zero, the word is no longer in the set, so we remove it.
+	//
+	node* parent;
+	node* p = search(word, parent);
+
+	if (p == nullptr) // If the word isn't in the tree,
+	{
+		return false; // there is nothing to decrement.
+	}
+
+	if (p->count > 1)	// If the word was inserted more than once,
+	{
+		p->count--;		// we just lower its count.
+	}
+	else
+	{
+		removeNode(p, parent); // Otherwise, it is going away entirely.
+	}
+
+	return true;
+}
+
+void BST::removeNode(node* p, node* parent)
+{
+	// This method unlinks node p, whose parent is given, from the tree. If p has at
+	// most one child, that child just takes p's place. If p has two children, we
+	// splice p's successor (the smallest word in its right subtree) out of its spot
+	// and link it into p's place, so that no words have to be copied between nodes.
+	//
+	node* replacement; // The node that will take p's place under its parent
+
+	if (p->leftChild == nullptr || p->rightChild == nullptr) // If p has at most one child,
+	{
+		replacement = p->leftChild != nullptr ? p->leftChild : p->rightChild; // that child (or nullptr) replaces p.
+	}
+	else
+	{
+		node* successorParent = p;			// The successor's parent, lagging one step behind it
+		replacement = p->rightChild;		// We start looking for the successor in p's right subtree,
+
+		while (replacement->leftChild != nullptr)	// and go as far left as we can.
+		{
+			successorParent = replacement;
+			replacement = replacement->leftChild;
+		}
+
+		if (successorParent != p) // If the successor isn't p's right child, we have to splice it out of its spot first.
+		{
+			successorParent->leftChild = replacement->rightChild;	// The successor's right subtree takes its place,
+			replacement->rightChild = p->rightChild;				// and the successor picks up p's right subtree.
+			numberOfReferenceChanges += 2;							// We've changed two references.
+		}
+
+		replacement->leftChild = p->leftChild;	// Either way, the successor picks up p's left subtree.
+		numberOfReferenceChanges++;				// We've changed another reference.
+		numberOfSuccessorSplices++;				// We've spliced a successor into place.
+	}
+
+	if (parent == nullptr)			// If p was the root,
+	{
+		root = replacement;			// its replacement is the new root.
+	}
+	else if (parent->leftChild == p) // Otherwise, the replacement goes on whichever side of the parent p was on.
+	{
+		parent->leftChild = replacement;
+	}
+	else
+	{
+		parent->rightChild = replacement;
+	}
+
+	numberOfReferenceChanges++;	// We've changed the reference to p.
+	numberOfDeletions++;		// We've deleted a node.
+
+	releaseNode(p); // p is no longer in the tree, so it goes onto the free list.
+}
+
 void BST::list()
 {
-	// This method traverses through the entire tree and prints out the nodes in a nicely formatted list
-	// with indexes and the node's word and count.
+	// This method prints out every word in the tree in a nicely formatted list with indexes and
+	// each node's word and count. We used to do this with a recursive traversal, which goes as
+	// deep as the tree does. Instead, we take the words a page at a time through nextPage, the
+	// same way any other listing would, which needs no recursion and only one page of memory.
 	//
 	if (root == nullptr) // If the root is nullptr, than there is nothing in the tree,
 	{
@@ -154,49 +335,224 @@ void BST::list()
 	{
 		cout << "Set contains: "; // so we print out "Set contains: " as a prefix,
 
+		WordCursor cursor;				// We start at the first word,
+		WordEntry page[LIST_PAGE_SIZE];	// and take a page of words at a time.
+		size_t filled;
 		int index = 0; // We set up a index variable to 0 that is incremented before printing a node
 
-		list(index, root); // We now start our recursive traversal through the root node with our overloaded list method.
+		while ((filled = nextPage(cursor, page, LIST_PAGE_SIZE)) > 0)
+		{
+			for (size_t i = 0; i < filled; i++)
+			{
+				if (index != 0) // Every word after the first is separated from the one before it by a comma.
+				{
+					cout << ", ";
+				}
+
+				cout << "(" << ++index << ") " << page[i].word << " " << page[i].count;
+			}
+		}
 
-		cout << endl; // We finish off the output by printing out a newline, as we never did it inside the above method call.
+		cout << endl; // We finish off the output by printing out a newline.
 	}
 };
 
-void BST::list(int& index, node* p)
+void BST::merge(const BST& other)
 {
-	// This method does a recursive traversal through all of the nodes in the tree
-	// and prints out their word and count with an index parameter. The index
-	// parameter is passed by reference so that no matter which recursive call
-	// of this method we are in, the correct index will always be printed out.
-	// Through talking with Dr. Thomas, I learned that the index variable could
-	// have been a class variable instead. I enjoy this method because it does
-	// not require any cleanup or setup of a class variable.
+	// This method adds every word of the other tree to this one, along with its count. Inserting
+	// the other tree's words one at a time would cost O(m log(n + m)) and a trip down the tree
+	// for each of them. Instead, we walk both trees in order at the same time, the way merge
+	// sort merges two sorted lists, and then relink the merged list of nodes into a perfectly
+	// balanced tree, so the whole merge takes O(n + m) time. Our own nodes are reused as they
+	// are (only their links change), so only the words that were just in the other tree are
+	// copied. The other tree isn't changed, unless it is this tree, in which case every count
+	// doubles (both iterators are on the same node every step, so it adds its count to itself).
 	//
-	if (p->leftChild != nullptr)   // If the left child of the node is not null,
+	vector<node*> merged;	// Every node of the merged tree, in alphabetical order
+	iterator mine = lowerBound(nullptr, WordBound());			// Our next word
+	iterator theirs = other.lowerBound(nullptr, WordBound());	// The other tree's next word
+	iterator end;
+
+	while (mine != end || theirs != end) // Until both trees run out,
 	{
-		list(index, p->leftChild); // we print out the left child node as well, recursively taking care of its children.
+		int compareValue; // Less than zero if our word comes first, greater than zero if theirs does
+
+		if (mine == end)
+		{
+			compareValue = 1;
+		}
+		else if (theirs == end)
+		{
+			compareValue = -1;
+		}
+		else
+		{
+			compareValue = strcmp(mine.current()->word, theirs.current()->word);
+			numberOfKeyComparisonsMade++;
+		}
+
+		if (compareValue <= 0) // If our word comes first (or both trees have it), we keep our node,
+		{
+			node* p = mine.current();
 
-		// Since we have now printed out the left child node, we need to print
-		// out a comma to separate it from the node we are about to print.
-		//
-		cout << ", ";
+			if (compareValue == 0) // adding the other tree's count to ours if it has the word too.
+			{
+				p->count += theirs.current()->count;
+				++theirs;
+			}
+
+			merged.push_back(p);
+			++mine;
+		}
+		else // If their word comes first, it needs a node of its own.
+		{
+			node* p = allocateNode();
+
+			strcpy(p->word, theirs.current()->word);
+			p->count = theirs.current()->count;
+
+			merged.push_back(p);
+			++theirs;
+		}
 	}
 
-	// We now print out the index AFTER incrementing it, as well as the node's
-	// word and count.
-	cout << "(" << ++index << ") " << p->word << " " << p->count;
+	root = buildBalanced(merged, 0, merged.size()); // We link the nodes up again, balanced.
+	numberOfReferenceChanges++;
+}
 
-	if (p->rightChild != nullptr) // If the right child of the node is not null,
+BST::node* BST::buildBalanced(vector<node*>& nodes, size_t first, size_t last)
+{
+	// This method links nodes[first] to nodes[last - 1], which are in alphabetical order, into
+	// a perfectly balanced subtree and returns its root. The middle node is the root, and the
+	// nodes on each side of it make up its subtrees. The recursion is only as deep as the
+	// tree is tall, which after a merge is about log2(n), however tall the tree was before.
+	//
+	if (first == last) // An empty range is an empty subtree.
 	{
-		// we print out a comma to separate the node we already printed from
-		// the right child we are about to print.
-		cout << ", ";
+		return nullptr;
+	}
+
+	size_t middle = first + (last - first) / 2;
+	node* p = nodes[middle];
+
+	p->leftChild = buildBalanced(nodes, first, middle);
+	p->rightChild = buildBalanced(nodes, middle + 1, last);
+	numberOfReferenceChanges += 2;
+
+	return p;
+}
 
-		list(index, p->rightChild); // we now print out the right child node as well, recursively taking care of its children.
+BST::iterator BST::lowerBound(const char* lo, const WordBound& bound) const
+{
+	// This method finds the first word in the tree that isn't less than lo. Since we
+	// don't have parent pointers, we remember every node we go left of on our way down,
+	// since those are exactly the nodes that come after the one we stop on. Queries
+	// don't count toward our insert statistics.
+	//
+	iterator it;		// The iterator we are building,
+	it.bound = bound;	// which stops at the given bound.
+
+	node* p = root; // We start our search at the root.
+
+	while (p != nullptr) // While we haven't fallen off the bottom of the tree,
+	{
+		if (lo == nullptr || strcmp(p->word, lo) >= 0) // if p's word isn't less than lo, p might be our answer,
+		{
+			it.stack.push_back(p);	// so we remember it,
+			p = p->leftChild;		// and look for a smaller answer to its left.
+		}
+		else						// Otherwise, p's word is too small,
+		{
+			p = p->rightChild;		// so the answer has to be to its right.
+		}
 	}
+
+	if (!it.stack.empty() && !bound.admits(it.stack.back()->word)) // If the first word is already past the bound,
+	{
+		it.stack.clear(); // our iterator starts at the end.
+	}
+
+	return it;
 }
 
-void BST::calculateNumWords(unsigned int& numWords, unsigned int& numUniqueWords)
+WordRange<BST::iterator> BST::words() const
+{
+	// Every word in the tree is the range starting at the smallest word with no bound.
+	return WordRange<iterator>(lowerBound(nullptr, WordBound()), iterator());
+}
+
+WordRange<BST::iterator> BST::rangeQuery(const char* lo, const char* hi) const
+{
+	// A range query starts at the first word not less than lo and stops after hi.
+	return WordRange<iterator>(lowerBound(lo, WordBound(WordBound::UPPER_BOUND, hi)), iterator());
+}
+
+WordRange<BST::iterator> BST::prefixQuery(const char* prefix) const
+{
+	// Every word that starts with the prefix is at least as big as the prefix itself,
+	// so we start there and stop at the first word that doesn't start with it.
+	return WordRange<iterator>(lowerBound(prefix, WordBound(WordBound::PREFIX, prefix)), iterator());
+}
+
+vector<WordCount> BST::topK(size_t k) const
+{
+	// We find the top k words with a single pass over every word in the tree.
+	return selectTopK(words(), k);
+}
+
+size_t BST::nextPage(WordCursor& cursor, WordEntry* buffer, size_t capacity) const
+{
+	// The page starts at the first word that isn't less than the cursor's last word, which we
+	// find the same way a range query does, and fillPage skips that word if it is still here.
+	return fillPage(lowerBound(cursor.started ? cursor.last : nullptr, WordBound()), iterator(), cursor, buffer, capacity);
+}
+
+WordCount BST::iterator::operator*() const
+{
+	return { stack.back()->word, stack.back()->count }; // The current node is on top of the stack.
+}
+
+BST::iterator& BST::iterator::operator++()
+{
+	// To move on to the next word, we pop the current node off of the stack. If it has
+	// a right subtree, the next word is the smallest word in that subtree, so we push
+	// the path down to it. Otherwise, the next word is the node we went left of most
+	// recently, which is already on top of the stack.
+	//
+	node* p = stack.back()->rightChild; // We will walk down the current node's right subtree,
+
+	stack.pop_back(); // after we are done with the current node.
+
+	while (p != nullptr)		// While there are more nodes on the way down,
+	{
+		stack.push_back(p);		// we remember each one,
+		p = p->leftChild;		// and keep going left to reach the smallest word.
+	}
+
+	if (!stack.empty() && !bound.admits(stack.back()->word)) // If we've gone past the bound,
+	{
+		stack.clear(); // we are at the end.
+	}
+
+	return *this;
+}
+
+bool BST::iterator::operator==(const iterator& other) const
+{
+	return current() == other.current();
+}
+
+bool BST::iterator::operator!=(const iterator& other) const
+{
+	return current() != other.current();
+}
+
+BST::node* BST::iterator::current() const
+{
+	return stack.empty() ? nullptr : stack.back(); // An empty stack means we are at the end.
+}
+
+void BST::calculateNumWords(unsigned long long& numWords, unsigned long long& numUniqueWords)
 {
 	// This method calculates the number of words and unique words in the tree.
 	// The method takes two unsigned integer references that it initializes to zero.
@@ -206,27 +562,41 @@ void BST::calculateNumWords(unsigned int& numWords, unsigned int& numUniqueWords
 	numWords = 0;
 	numUniqueWords = 0;
 
-	calculateNumWords(root, numWords, numUniqueWords); // We call the calculation method at the root node so we can count the whole tree.
+	if (root != nullptr) // If the tree isn't empty,
+	{
+		calculateNumWords(root, numWords, numUniqueWords); // we call the calculation method at the root node so we can count the whole tree.
+	}
 }
 
-void BST::calculateNumWords(node* p, unsigned int& numWords, unsigned int& numUniqueWords)
+void BST::calculateNumWords(node* p, unsigned long long& numWords, unsigned long long& numUniqueWords)
 {
-	// This method does a recursive traversal through all of the nodes in the tree
-	// and increments the references to the number of words and unique words through
-	// each call.
+	// This method does a traversal through all of the nodes under the given node
+	// and increments the references to the number of words and unique words for
+	// each one. Like traverseDestruct, we keep our own stack of nodes to visit so
+	// that a very deep tree can't run us out of stack.
 	//
-	if (p->leftChild != nullptr) // If the left child of the node is not null,
-	{
-		calculateNumWords(p->leftChild, numWords, numUniqueWords); // we call the method on the left child of the node.
-	}
+	vector<node*> stack; // The nodes we still have to count
 
-	if (p->rightChild != nullptr) // If the right child of the node is not null,
+	stack.push_back(p);
+
+	while (!stack.empty()) // While there are still nodes to count,
 	{
-		calculateNumWords(p->rightChild, numWords, numUniqueWords); // we call the method on the left child of the node.
-	}
+		p = stack.back(); // we take one off of the stack,
+		stack.pop_back();
+
+		if (p->leftChild != nullptr) // push its children to count later,
+		{
+			stack.push_back(p->leftChild);
+		}
 
-	numWords += p->count;	// We increment the number of words by the node's count,
-	numUniqueWords += 1;	// and the number of unique words by one, as each node represents a unique word.
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(p->rightChild);
+		}
+
+		numWords += p->count;	// increment the number of words by the node's count,
+		numUniqueWords += 1;	// and the number of unique words by one, as each node represents a unique word.
+	}
 }
 
 unsigned int BST::getHeight()
@@ -252,27 +622,287 @@ unsigned int BST::getHeight()
 
 void BST::calculateHeight(node* p, unsigned int& height, unsigned int traversalHeight)
 {
-	// This method does a recursive traversal of the given node and gets called on every node
-	// underneath it. As it traverses through each node, the traversal height gets incremented
-	// by one, and the height gets changed to the traversal height if the traversal height is greater
-	// than it.
+	// This method does a traversal of the given node and every node underneath it. Each
+	// node is visited with its traversal height, which is one more than its parent's,
+	// and the height gets changed to the traversal height if the traversal height is greater
+	// than it. We keep our own stack of nodes (and their traversal heights) to visit, since
+	// a BST built from sorted input is far too deep to recurse through.
 	//
-	if (p->leftChild != nullptr) // If p has a left child,
+	vector<pair<node*, unsigned int>> stack; // The nodes we still have to visit, along with their traversal heights
+
+	stack.push_back(make_pair(p, traversalHeight));
+
+	while (!stack.empty()) // While there are still nodes to visit,
 	{
-		// we recursively call calculateHeight on it, incrementing the traversal height by one since we have gone down a level of the tree.
-		calculateHeight(p->leftChild, height, traversalHeight + 1);
+		p = stack.back().first;						// we take one off of the stack.
+		traversalHeight = stack.back().second;
+		stack.pop_back();
+
+		if (p->leftChild != nullptr) // If p has a left child, we visit it one level further down the tree.
+		{
+			stack.push_back(make_pair(p->leftChild, traversalHeight + 1));
+		}
+
+		if (p->rightChild != nullptr) // If p has a right child, we do the same.
+		{
+			stack.push_back(make_pair(p->rightChild, traversalHeight + 1));
+		}
+
+		if (height < traversalHeight)	// If the height is less than the traversal height,
+		{
+			height = traversalHeight;	// than we set the height to the traversal height, as we now have a new height of the tree.
+		}
 	}
+}
+
+unsigned int BST::find(const char word[50])
+{
+	// This method walks down the tree looking for the word, just like insert does, but
+	// it doesn't change anything. Lookups don't count toward our insert statistics.
+	//
+	node* p = root;
+	size_t depth = 0; // The number of nodes we have compared our word against
 
-	if (p->rightChild != nullptr) // If p has a right child,
+	while (p != nullptr) // While there are more nodes to look at,
 	{
-		// we recursively call calculateHeight on it, incrementing the traversal height by one since we have gone down a level of the tree.
-		calculateHeight(p->rightChild, height, traversalHeight + 1);
+		if (prefetching) // we start loading both children if we are prefetching,
+		{
+			prefetchObject(p->leftChild);
+			prefetchObject(p->rightChild);
+		}
+
+		int compareValue = strcmp(word, p->word); // compare our word to p's word,
+
+		depth++;
+
+		if (compareValue == 0) // and if they are the same, we found it!
+		{
+			lookupDepths.record(depth);
+
+			return p->count;
+		}
+
+		p = compareValue < 0 ? p->leftChild : p->rightChild; // Otherwise, we go down the side the word has to be on.
 	}
 
-	if (height < traversalHeight)	// If the height is less than the traversal height,
+	lookupDepths.record(depth);
+
+	return 0; // We fell off of the tree, so the word isn't in it.
+}
+
+unsigned int BST::depthOf(const char* word) const
+{
+	// This method walks down the tree like find does, but only keeps track of how deep it is.
+	//
+	node* p = root;
+	unsigned int depth = 1;
+
+	while (p != nullptr)
 	{
-		height = traversalHeight;	// than we set the height to the traversal height, as we now have a new height of the tree.
+		int compareValue = strcmp(word, p->word);
+
+		if (compareValue == 0)
+		{
+			return depth;
+		}
+
+		p = compareValue < 0 ? p->leftChild : p->rightChild;
+		depth++;
 	}
+
+	return 0;
+}
+
+void BST::findBatch(const char* const words[], size_t numberOfWords, unsigned int counts[])
+{
+	// This method looks up a whole array of words. Without prefetching, we just call find on
+	// each one. With prefetching, we look words up PREFETCH_GROUP_SIZE at a time, taking one
+	// step down the tree for each lookup in the group in turn. After each step, we prefetch
+	// the node that lookup will compare against next, and by the time we come back around to
+	// it, the node should be in the cache. This way, the lookups in a group wait on memory
+	// at the same time instead of one after another.
+	//
+	if (!prefetching)
+	{
+		for (size_t i = 0; i < numberOfWords; i++)
+		{
+			counts[i] = find(words[i]);
+		}
+
+		return;
+	}
+
+	for (size_t start = 0; start < numberOfWords; start += PREFETCH_GROUP_SIZE) // For each group of words,
+	{
+		size_t groupSize = numberOfWords - start < PREFETCH_GROUP_SIZE ? numberOfWords - start : PREFETCH_GROUP_SIZE;
+		node* cursors[PREFETCH_GROUP_SIZE];	// The node each lookup in the group is on, or nullptr once it is done
+		size_t depths[PREFETCH_GROUP_SIZE];	// The number of nodes each lookup in the group has compared against
+		size_t active = 0;					// The number of lookups in the group that aren't done yet
+
+		for (size_t i = 0; i < groupSize; i++) // every lookup starts at the root.
+		{
+			cursors[i] = root;
+			counts[start + i] = 0;
+			depths[i] = 0;
+
+			if (root != nullptr)
+			{
+				active++;
+			}
+		}
+
+		while (active > 0) // While any lookup in the group isn't done,
+		{
+			for (size_t i = 0; i < groupSize; i++) // we take one step with each lookup.
+			{
+				node* p = cursors[i];
+
+				if (p == nullptr) // This lookup is already done.
+				{
+					continue;
+				}
+
+				int compareValue = strcmp(words[start + i], p->word);
+
+				depths[i]++;
+
+				if (compareValue == 0) // If we found the word, we have its count and this lookup is done.
+				{
+					counts[start + i] = p->count;
+					p = nullptr;
+				}
+				else
+				{
+					p = compareValue < 0 ? p->leftChild : p->rightChild;
+				}
+
+				if (p == nullptr)
+				{
+					lookupDepths.record(depths[i]);
+					active--;
+				}
+				else
+				{
+					prefetchObject(p); // We start loading the next node now, and come back to it after the rest of the group.
+				}
+
+				cursors[i] = p;
+			}
+		}
+	}
+}
+
+void BST::setPrefetching(bool enabled)
+{
+	prefetching = enabled;
+}
+
+const DepthHistogram& BST::getLookupDepths() const
+{
+	return lookupDepths;
+}
+
+bool BST::validate() const
+{
+	// The only invariant a binary search tree has is its order: every word in a node's left
+	// subtree is smaller than the node's word, and every word in its right subtree is bigger,
+	// which is the same as the in-order walk being sorted. The iterator walks with a stack of
+	// its own, so this works on a tree as deep as it has nodes.
+	//
+	const char* previous = nullptr; // The word before the one we are on, in alphabetical order
+
+	for (WordCount w : words()) // An in-order walk has to see the words in strictly increasing order,
+	{
+		if (previous != nullptr && strcmp(previous, w.word) >= 0)
+		{
+			cout << "BST is invalid: \"" << w.word << "\" comes after \"" << previous << "\"\n";
+
+			return false;
+		}
+
+		if (w.count == 0) // and every word in the tree has to have been inserted at least once.
+		{
+			cout << "BST is invalid: \"" << w.word << "\" has a count of zero\n";
+
+			return false;
+		}
+
+		previous = w.word;
+	}
+
+	return true;
+}
+
+unsigned long long BST::getKeyComparisons()
+{
+	return numberOfKeyComparisonsMade;
+}
+
+unsigned long long BST::getReferenceChanges()
+{
+	return numberOfReferenceChanges;
+}
+
+unsigned long long BST::getMemoryUsage()
+{
+	// This method returns the number of bytes the nodes of the tree take up. Every distinct
+	// word has a node, so this is just the number of nodes times the size of a node.
+	//
+	unsigned long long numWords, numUniqueWords;
+
+	calculateNumWords(numWords, numUniqueWords);
+
+	return numUniqueWords * sizeof(node);
+}
+
+unsigned long long BST::getAllocatedBytes()
+{
+	// This method adds up how big the allocator says each node's block really is, which
+	// includes whatever the allocator rounded the node's size up by. We visit every node
+	// with our own stack of nodes, the same way the iterators do.
+	//
+	unsigned long long bytes = 0;
+	vector<node*> stack;
+
+	if (root != nullptr)
+	{
+		stack.push_back(root);
+	}
+
+	while (!stack.empty()) // While there are still nodes to visit,
+	{
+		node* p = stack.back(); // we take one off of the stack,
+		stack.pop_back();
+
+		bytes += MemoryUsage::allocatedSize(p); // count its block,
+
+		if (p->leftChild != nullptr) // and push its children to visit later.
+		{
+			stack.push_back(p->leftChild);
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(p->rightChild);
+		}
+	}
+
+	return bytes + getFreeListBytes(); // The removed nodes on the free list are still ours too.
+}
+
+unsigned long long BST::getFreeListBytes()
+{
+	// This method adds up the blocks of the removed nodes waiting on the free list. They
+	// aren't part of the tree anymore, but the allocator hasn't gotten them back either.
+	//
+	unsigned long long bytes = 0;
+
+	for (node* p = freeList; p != nullptr; p = p->leftChild)
+	{
+		bytes += MemoryUsage::allocatedSize(p);
+	}
+
+	return bytes;
 }
 
 void BST::displayStatistics()
@@ -280,15 +910,31 @@ void BST::displayStatistics()
 	// This method displays statistics related to the number of words in the tree and
 	// insertion statistics as nodes are inserted into the binary search tree.
 	//
-	unsigned int numWords, numUniqueWords; // Declare variables for the total number of words and unique words in the tree
+	unsigned long long numWords, numUniqueWords; // Declare variables for the total number of words and unique words in the tree
 
 	// Call the calculateNumWords, passing in our word counts by reference so that they are set to the proper values
 	calculateNumWords(numWords, numUniqueWords);
 
+	unsigned long long liveBytes = getMemoryUsage(); // We also find out how much memory the nodes take up,
+	unsigned long long allocatedBytes = getAllocatedBytes(); // and how much the allocator really set aside for them.
+	unsigned long long freeListBytes = getFreeListBytes(); // Some of that may be removed nodes waiting on the free list.
+
 	cout << "BST Stats:\n"; // Print out a header specifying that these are BST stats
 	cout << "Distinct Words: " << numUniqueWords << "\n"; // Print out the total number of unique words
 	cout << "Total Words: " << numWords << "\n"; // Print out the total number of words
 	cout << "Height: " << getHeight() << "\n"; // Print out the height of the tree
+	cout << "Node Size: " << sizeof(node) << " bytes\n"; // Print out how big a single node is
+	cout << "Live Bytes: " << liveBytes << "\n"; // Print out the number of bytes the nodes take up
+	cout << "Allocated Bytes: " << allocatedBytes << "\n"; // Print out the number of bytes the allocator set aside for them
+	cout << "Free List Bytes: " << freeListBytes << "\n"; // Print out how much of that is removed nodes waiting to be reused
+	cout << "Allocator Overhead: " << (allocatedBytes > liveBytes + freeListBytes ? allocatedBytes - liveBytes - freeListBytes : 0) << " bytes\n"; // Print out how much of the rest is rounding
+	cout << "Bytes per Distinct Word: " << (numUniqueWords > 0 ? (double)allocatedBytes / numUniqueWords : 0) << "\n"; // Print out what each distinct word costs
 	cout << "Reference Changes: " << numberOfReferenceChanges << "\n"; // Print out the total number of reference changes made
 	cout << "Key Comparisons: " << numberOfKeyComparisonsMade << "\n"; // Print out the total number of key comparisons made
+	cout << "Deletions: " << numberOfDeletions << "\n"; // Print out the total number of nodes removed
+	cout << "Successor Splices: " << numberOfSuccessorSplices << "\n"; // Print out the number of removals that spliced in a successor
+	insertDepths.display("Insert Depths"); // Print out how many nodes each insert looked at
+
+	// Print out where the ten most frequent words are, which is where most of the inserts went.
+	displayWordDepths("Top Word Depths", topK(10), [this](const char* word) { return depthOf(word); });
 }
\ No newline at end of file
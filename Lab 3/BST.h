@@ -14,6 +14,12 @@
 
 #include <iostream>
 #include "time.h"
+#include "Statistics.h"
+#include "MemoryUsage.h"
+#include "Prefetch.h"
+#include "WordQuery.h"
+#include "DepthHistogram.h"
+#include <vector>
 
 using namespace std;
 
@@ -24,8 +30,36 @@ public:
 	~BST();
 
 	void insert(const char word[50]); // adds a word to the tree
+	bool remove(const char word[50]); // removes a word from the tree no matter its count, returning false if it wasn't there
+	bool decrement(const char word[50]); // lowers a word's count by one, removing it at zero, returning false if it wasn't there
 	void list(); // Prints a list of all words in the tree.
 	void displayStatistics(); // Displays statistics about the tree operations performed.
+
+	// Adds every word of the other tree to this one, along with its count, in O(n + m) time, leaving
+	// this tree perfectly balanced. The other tree isn't changed.
+	void merge(const BST& other);
+
+	// Checks every invariant of the tree in O(n) time without recursion, printing the first one that
+	// is broken. Returns true if it is valid.
+	bool validate() const;
+
+	// Returns the number of times the word has been inserted, or zero if it isn't in the tree
+	unsigned int find(const char word[50]);
+
+	// Looks up many words at once, setting counts[i] to what find(words[i]) would return. With
+	// prefetching on, several lookups are interleaved so that their cache misses overlap.
+	void findBatch(const char* const words[], size_t numberOfWords, unsigned int counts[]);
+
+	// Turns prefetching of both children during inserts and lookups on or off. It is off by default.
+	void setPrefetching(bool enabled);
+
+	unsigned long long getKeyComparisons(); // Returns the number of key comparisons made so far
+	unsigned long long getReferenceChanges(); // Returns the number of reference changes made so far
+	unsigned int getHeight(); // Returns the height of the tree
+	unsigned long long getMemoryUsage(); // Returns the number of bytes taken up by the nodes of the tree
+	unsigned long long getAllocatedBytes(); // Returns the number of bytes the allocator set aside for the nodes of the tree, including removed ones waiting to be reused
+	unsigned long long getFreeListBytes(); // Returns the number of those bytes that belong to removed nodes on the free list
+	const DepthHistogram& getLookupDepths() const; // Returns the depths of every find so far
 private:
 	struct node
 	{
@@ -35,23 +69,74 @@ private:
 		node* rightChild = nullptr; // A pointer to the right child of the node
 	};
 
-	void traverseDestruct(node* p); // Traverses through the given node and deletes its children recursively as well as itself
+public:
+	// An iterator that walks through the words of the tree in alphabetical order. Since our nodes
+	// don't have parent pointers, it keeps a stack of the nodes it still has to come back to.
+	class iterator
+	{
+	public:
+		WordCount operator*() const;					// Returns the word and count of the node the iterator is on
+		iterator& operator++();							// Moves the iterator on to the next word in alphabetical order
+		bool operator==(const iterator& other) const;	// Two iterators are equal if they are on the same node
+		bool operator!=(const iterator& other) const;
+	private:
+		friend class BST;
 
-	// Calculates the number of words and unique words in the binary search tree.
-	void calculateNumWords(unsigned int& numWords, unsigned int& numUniqueWords);
+		node* current() const; // Returns the node the iterator is on, or nullptr if it is at the end
 
-	// Recursively calculates the number of words and unique words by counting the given node's words and its two children.
-	void calculateNumWords(node* p, unsigned int& numWords, unsigned int& numUniqueWords);
+		vector<node*> stack;	// The nodes we have gone left of but not visited yet. The top of the stack is the current node.
+		WordBound bound;		// Where the iteration stops
+	};
 
-	void list(int& index, node* p); // Traverses through the children of a node as well as the node and prints
+	WordRange<iterator> words() const; // Returns every word in the tree, in alphabetical order
+	WordRange<iterator> rangeQuery(const char* lo, const char* hi) const; // Returns the words from lo to hi, including lo and hi
+	WordRange<iterator> prefixQuery(const char* prefix) const; // Returns the words that start with the given prefix
+	vector<WordCount> topK(size_t k) const; // Returns the k most frequent words in the tree, most frequent first
 
-	unsigned int getHeight(); // Returns the height of the tree
+	// Copies the next page of up to capacity words (and their counts), in alphabetical order, into the
+	// buffer, starting after the cursor's last word, and moves the cursor along. Finding where the page
+	// starts takes as long as a search, however far into the listing the cursor is. Returns the number of
+	// words copied, which is zero once the cursor has gone past the last word.
+	size_t nextPage(WordCursor& cursor, WordEntry* buffer, size_t capacity) const;
+private:
+	// Returns an iterator on the first word that isn't less than lo (or the first word if lo is nullptr) which stops at the given bound
+	iterator lowerBound(const char* lo, const WordBound& bound) const;
+
+	void traverseDestruct(node* p); // Traverses through the given node and deletes its children as well as itself
+
+	node* allocateNode(); // Returns a fresh node, reusing one from the free list if we have one
+	void releaseNode(node* p); // Puts a node that was removed from the tree onto the free list
+
+	// Links the given nodes, which are in alphabetical order, into a perfectly balanced subtree from
+	// first up to (but not including) last. Returns its root.
+	node* buildBalanced(vector<node*>& nodes, size_t first, size_t last);
+
+	// Searches for the node with the given word, setting parent to its parent. Returns nullptr if the word isn't in the tree.
+	node* search(const char word[50], node*& parent);
+
+	void removeNode(node* p, node* parent); // Unlinks the given node from the tree and releases it
 
-	// Recursively calculates the height of the tree by traversing through the given node and its children
+	// Calculates the number of words and unique words in the binary search tree.
+	void calculateNumWords(unsigned long long& numWords, unsigned long long& numUniqueWords);
+
+	// Calculates the number of words and unique words by counting the words of the given node and every node under it.
+	void calculateNumWords(node* p, unsigned long long& numWords, unsigned long long& numUniqueWords);
+
+	// Calculates the height of the tree by traversing through the given node and its children
 	void calculateHeight(node* p, unsigned int& height, unsigned int traversalHeight);
 
 	node* root = nullptr; // A pointer to the root of the binary search tree. If this is nullptr, no nodes exist in the tree.
+	node* freeList = nullptr; // A list of removed nodes, linked through their left child pointers, that we reuse before allocating new ones.
+	bool prefetching = false; // Whether or not we prefetch both children of each node we pass on the way down
+
+	// Returns the depth of the word's node, counting the root as 1, or zero if it isn't in the tree. This doesn't count toward any statistics.
+	unsigned int depthOf(const char* word) const;
+
+	DepthHistogram insertDepths; // How many nodes each insert compared its word against, whether it found the word or added it
+	DepthHistogram lookupDepths; // How many nodes each find compared its word against
 
-	unsigned long long numberOfReferenceChanges = 0;	// Keeps track of the number of times the root pointer or child pointers change.
-	unsigned long long numberOfKeyComparisonsMade = 0;	// Keeps track of the number of word key comparisons during tree inserts.
+	statistic numberOfReferenceChanges = 0;		// Keeps track of the number of times the root pointer or child pointers change.
+	statistic numberOfKeyComparisonsMade = 0;	// Keeps track of the number of word key comparisons during tree inserts and deletions.
+	statistic numberOfDeletions = 0;			// Keeps track of the number of nodes removed from the tree.
+	statistic numberOfSuccessorSplices = 0;		// Keeps track of the number of times a removed node with two children was replaced by its successor.
 };
\ No newline at end of file
@@ -0,0 +1,43 @@
+//==============================================================================================
+// File: Bits.h - Bit manipulation helpers
+//
+// Small portable wrappers around the compiler intrinsics for bit scanning, so that the
+// datatypes can use them without caring whether they are built with Visual C++ or GCC/Clang.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Returns the number of zero bits below the lowest one bit of x, or 64 if x is zero.
+inline int countTrailingZeros(unsigned long long x)
+{
+	if (x == 0)
+	{
+		return 64;
+	}
+
+#if defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, x);
+	return (int)index;
+#elif defined(_MSC_VER)
+	// 32-bit Visual C++ has no 64-bit bit scan, so we scan each half.
+	unsigned long index;
+	if (_BitScanForward(&index, (unsigned long)x))
+	{
+		return (int)index;
+	}
+	_BitScanForward(&index, (unsigned long)(x >> 32));
+	return (int)index + 32;
+#else
+	return __builtin_ctzll(x);
+#endif
+}
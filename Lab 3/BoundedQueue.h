@@ -0,0 +1,104 @@
+//==============================================================================================
+// File: BoundedQueue.h - A bounded multiple producer, single consumer queue
+//
+// When several threads tokenize files for one datatype, the tokenizers hand their words to
+// the thread that inserts them through one of these. It holds at most a fixed number of
+// items: a producer that finds it full waits for the consumer to catch up, so if the datatype
+// is slower than the tokenizers, they can't fill up memory with words that haven't been
+// inserted yet. Once every producer is done, the queue is closed, which lets the consumer
+// empty it and then tells it that nothing more is coming.
+//
+// Everything is done under one mutex. The items are batches of words, so the queue is only
+// touched once per batch and the lock is never what anybody is waiting on. We count how often
+// each side had to wait, which tells us whether the tokenizers or the datatype was the bottleneck.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+using namespace std;
+
+template <class T>
+class BoundedQueue
+{
+public:
+	BoundedQueue(size_t capacity) : capacity(capacity) {}
+
+	void push(const T& item) // Adds an item to the back of the queue, waiting for room if it is full
+	{
+		unique_lock<mutex> lock(guard);
+
+		if (items.size() >= capacity)
+		{
+			numberOfFullWaits++;
+			notFull.wait(lock, [this] { return items.size() < capacity; });
+		}
+
+		items.push_back(item);
+		notEmpty.notify_one(); // There is only ever one consumer to wake up.
+	}
+
+	// Takes the item at the front of the queue, waiting for one if the queue is empty. Returns
+	// false once the queue is closed and empty, since then no more items can ever come.
+	bool pop(T& item)
+	{
+		unique_lock<mutex> lock(guard);
+
+		if (items.empty() && !closed)
+		{
+			numberOfEmptyWaits++;
+			notEmpty.wait(lock, [this] { return !items.empty() || closed; });
+		}
+
+		if (items.empty())
+		{
+			return false;
+		}
+
+		item = items.front();
+		items.pop_front();
+		notFull.notify_one(); // Any one of the waiting producers can have the room we just made.
+
+		return true;
+	}
+
+	void close() // Says that nothing more will be pushed, waking up the consumer if it is waiting
+	{
+		lock_guard<mutex> lock(guard);
+
+		closed = true;
+		notEmpty.notify_all();
+	}
+
+	unsigned long long getFullWaits() // Returns the number of times a producer had to wait for room
+	{
+		lock_guard<mutex> lock(guard);
+
+		return numberOfFullWaits;
+	}
+
+	unsigned long long getEmptyWaits() // Returns the number of times the consumer had to wait for an item
+	{
+		lock_guard<mutex> lock(guard);
+
+		return numberOfEmptyWaits;
+	}
+private:
+	mutex guard;					// Protects everything below
+	condition_variable notFull;		// Signaled when an item is taken out, for producers waiting for room
+	condition_variable notEmpty;	// Signaled when an item is added or the queue is closed, for the consumer
+	deque<T> items;					// The items in the queue, front first
+	size_t capacity;				// The most items the queue can hold
+	bool closed = false;			// Whether or not the producers are all done
+
+	unsigned long long numberOfFullWaits = 0;	// The number of times a producer found the queue full
+	unsigned long long numberOfEmptyWaits = 0;	// The number of times the consumer found the queue empty
+};
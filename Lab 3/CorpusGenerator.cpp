@@ -0,0 +1,293 @@
+//==============================================================================================
+// File: CorpusGenerator.cpp - Synthetic corpus generator implementation
+// c.f.: CorpusGenerator.h
+//
+// This class makes up a corpus of words so that we can see how each datatype's insert cost
+// grows with the size of its input, which a single input file can't show us. The corpus is
+// described by a handful of parameters: how many words it has, how many distinct words they
+// are drawn from, how skewed the word frequencies are (a Zipf distribution, which is how word
+// frequencies in real text behave), how long the words are, and what order they come in.
+// Everything is generated from a seed, so the same parameters always give the same corpus.
+//
+// The vocabulary is made up once, up front. Each word is a run of random letters followed by
+// its rank written in base 26 (with enough digits for the whole vocabulary), which makes every
+// word distinct without making frequent words alphabetically close to each other. The words
+// are then streamed out one at a time, so the corpus itself never has to fit in memory and can
+// be billions of words long.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "CorpusGenerator.h"
+#include <cmath>
+#include <algorithm>
+
+CorpusGenerator::CorpusGenerator(unsigned long long numberOfWords, unsigned int vocabularySize, double zipfExponent,
+	int minLength, int maxLength, order wordOrder, unsigned long long seed)
+{
+	// constructor -- we save our parameters, making sure they make sense, then make up
+	// the vocabulary and the distribution we draw words from.
+	//
+	this->numberOfWords = numberOfWords;
+	this->vocabularySize = vocabularySize < 1 ? 1 : vocabularySize;	// We need at least one word to draw,
+	this->zipfExponent = zipfExponent < 0 ? 0 : zipfExponent;			// and a negative exponent would favor rare words.
+	this->minLength = minLength < 1 ? 1 : (minLength > 49 ? 49 : minLength); // Words are between 1 and 49 characters,
+	this->maxLength = maxLength < this->minLength ? this->minLength : (maxLength > 49 ? 49 : maxLength); // and the longest can't be shorter than the shortest.
+	this->wordOrder = wordOrder;
+	this->seed = seed;
+
+	// The vocabulary and the words we draw use separate random number generators, so that
+	// the vocabulary doesn't change when the number of words or their order does.
+	generator = mt19937_64(seed + 1);
+
+	buildVocabulary();
+	buildDistribution();
+}
+
+CorpusGenerator::~CorpusGenerator()
+{
+	// On deconstruction, we delete every array we made.
+	//
+	delete[] wordData;
+	delete[] wordOffsets;
+	delete[] alphabetical;
+	delete[] cumulativeProbability;
+	delete[] copies;
+}
+
+void CorpusGenerator::buildVocabulary()
+{
+	// This method makes up every word of the vocabulary. We first find out how many base 26
+	// digits the largest rank takes, since every word ends in its rank written with that
+	// many digits. Then we pick each word's length, so we know how much room all of the
+	// words need together, and finally fill in each word's random letters and its rank.
+	//
+	mt19937_64 vocabularyGenerator(seed); // The random number generator for making up words
+	uniform_int_distribution<int> lengthDistribution(minLength, maxLength);
+	uniform_int_distribution<int> letterDistribution(0, 25);
+
+	int digits = 1;						// The number of base 26 digits in a rank
+	unsigned long long capacity = 26;	// The number of ranks that many digits can write
+
+	while (capacity < vocabularySize)
+	{
+		digits++;
+		capacity *= 26;
+	}
+
+	unsigned char* lengths = new unsigned char[vocabularySize]; // The length of each word, which we only need until the words are written
+	unsigned long long totalLength = 0;
+
+	for (unsigned int rank = 0; rank < vocabularySize; rank++)
+	{
+		int length = lengthDistribution(vocabularyGenerator);
+
+		if (length < digits)	// A word has to be long enough to hold its rank,
+		{
+			length = digits;
+		}
+
+		if (length > 49)		// but never longer than 49 characters.
+		{
+			length = 49;
+		}
+
+		lengths[rank] = (unsigned char)length;
+		totalLength += length + 1; // Each word also needs room for its zero.
+	}
+
+	wordData = new char[totalLength];
+	wordOffsets = new unsigned long long[vocabularySize];
+
+	unsigned long long offset = 0;
+
+	for (unsigned int rank = 0; rank < vocabularySize; rank++)
+	{
+		char* word = wordData + offset;
+		int length = lengths[rank];
+		int letters = length - digits; // The number of random letters in front of the rank
+
+		wordOffsets[rank] = offset;
+
+		for (int i = 0; i < letters; i++) // We fill in the random letters,
+		{
+			word[i] = (char)('a' + letterDistribution(vocabularyGenerator));
+		}
+
+		unsigned int value = rank;
+
+		for (int i = length - 1; i >= letters; i--) // then write the rank, least significant digit last.
+		{
+			word[i] = (char)('a' + value % 26);
+			value /= 26;
+		}
+
+		word[length] = 0;
+		offset += length + 1;
+	}
+
+	delete[] lengths;
+
+	// Finally, we sort the ranks by their words so that the sorted orders can walk through them.
+	alphabetical = new unsigned int[vocabularySize];
+
+	for (unsigned int rank = 0; rank < vocabularySize; rank++)
+	{
+		alphabetical[rank] = rank;
+	}
+
+	sort(alphabetical, alphabetical + vocabularySize, [this](unsigned int a, unsigned int b)
+	{
+		return strcmp(wordOfRank(a), wordOfRank(b)) < 0;
+	});
+}
+
+void CorpusGenerator::buildDistribution()
+{
+	// This method calculates the cumulative probability of each rank, so that we can draw a
+	// rank by picking a random number between 0 and 1 and binary searching for the first
+	// rank whose cumulative probability is bigger than it. The word of rank r has a weight
+	// of 1 / r^s, and its probability is its weight divided by the total of every weight.
+	//
+	cumulativeProbability = new double[vocabularySize];
+
+	double total = 0;
+
+	for (unsigned int rank = 0; rank < vocabularySize; rank++)
+	{
+		total += 1.0 / pow(rank + 1.0, zipfExponent);
+		cumulativeProbability[rank] = total;
+	}
+
+	for (unsigned int rank = 0; rank < vocabularySize; rank++)
+	{
+		cumulativeProbability[rank] /= total;
+	}
+
+	if (wordOrder != SORTED && wordOrder != REVERSE_SORTED) // Only the sorted orders need to know each word's copies.
+	{
+		return;
+	}
+
+	// In the sorted orders, each word gets the whole number part of its share of the corpus,
+	// and the words left over go one each to the most frequent words, so the copies add up
+	// to exactly the number of words in the corpus.
+	copies = new unsigned long long[vocabularySize];
+
+	unsigned long long assigned = 0;
+	double previous = 0;
+
+	for (unsigned int rank = 0; rank < vocabularySize; rank++)
+	{
+		copies[rank] = (unsigned long long)((cumulativeProbability[rank] - previous) * numberOfWords);
+		assigned += copies[rank];
+		previous = cumulativeProbability[rank];
+	}
+
+	for (unsigned int rank = 0; assigned < numberOfWords; rank = (rank + 1) % vocabularySize)
+	{
+		copies[rank]++;
+		assigned++;
+	}
+}
+
+unsigned int CorpusGenerator::drawRank()
+{
+	// We draw a random number between 0 and 1, and the first rank whose cumulative probability
+	// is bigger than it is the rank we drew. Rounding can leave the last cumulative probability
+	// just under one, so we make sure we never go past the last rank.
+	//
+	double u = uniform_real_distribution<double>(0.0, 1.0)(generator);
+
+	unsigned int rank = (unsigned int)(upper_bound(cumulativeProbability, cumulativeProbability + vocabularySize, u) - cumulativeProbability);
+
+	return rank < vocabularySize ? rank : vocabularySize - 1;
+}
+
+const char* CorpusGenerator::wordOfRank(unsigned int rank)
+{
+	return wordData + wordOffsets[rank];
+}
+
+bool CorpusGenerator::nextWord(char word[50])
+{
+	// This method hands out the next word of the corpus, depending on the order we were given.
+	//
+	if (wordsGenerated == numberOfWords) // If we have handed out every word, we are done.
+	{
+		return false;
+	}
+
+	unsigned int rank;
+
+	switch (wordOrder)
+	{
+	case SORTED:
+	case REVERSE_SORTED:
+		while (copiesLeft == 0) // When we run out of copies of a word, we move on to the next word that has any.
+		{
+			currentRank = alphabetical[wordOrder == SORTED ? position : vocabularySize - 1 - position];
+			copiesLeft = copies[currentRank];
+			position++;
+		}
+
+		copiesLeft--;
+		rank = currentRank;
+		break;
+	case ADVERSARIAL:
+		// The first words are the whole vocabulary in alphabetical order, and the rest are random.
+		rank = wordsGenerated < vocabularySize ? alphabetical[wordsGenerated] : drawRank();
+		break;
+	default:
+		rank = drawRank();
+		break;
+	}
+
+	strcpy(word, wordOfRank(rank));
+
+	wordsGenerated++;
+
+	return true;
+}
+
+void CorpusGenerator::rewind()
+{
+	// Reseeding the generator we draw words with and going back to the first word
+	// makes us hand out exactly the same words again.
+	//
+	generator = mt19937_64(seed + 1);
+
+	wordsGenerated = 0;
+	copiesLeft = 0;
+	position = 0;
+}
+
+void CorpusGenerator::describe()
+{
+	// This method prints out everything needed to generate this corpus again.
+	//
+	const char* orderNames[] = { "random", "sorted", "reverse", "adversarial" };
+
+	cout << "Generated Corpus: " << numberOfWords << " words, " << vocabularySize << " distinct, Zipf exponent " << zipfExponent
+		<< ", lengths " << minLength << " to " << maxLength << ", " << orderNames[wordOrder] << " order, seed " << seed << "\n";
+}
+
+bool CorpusGenerator::parseOrder(const char* name, order& wordOrder)
+{
+	const char* orderNames[] = { "random", "sorted", "reverse", "adversarial" };
+
+	for (int o = RANDOM; o <= ADVERSARIAL; o++)
+	{
+		if (strcmp(name, orderNames[o]) == 0)
+		{
+			wordOrder = (order)o;
+
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,81 @@
+//==============================================================================================
+// File: CorpusGenerator.h - Synthetic corpus generator
+// Header for CorpusGenerator.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <cstring>
+#include <random>
+#include <iostream>
+#include "WordSource.h"
+
+using namespace std;
+
+class CorpusGenerator : public WordSource
+{
+public:
+	// The orders the words of the corpus can come in. RANDOM draws every word independently.
+	// SORTED and REVERSE_SORTED give each word the number of copies it would get on average,
+	// all in a row, in alphabetical (or reverse alphabetical) order. ADVERSARIAL gives every
+	// word once in alphabetical order, which turns a BST into a linked list, then draws the
+	// rest of the words randomly so that every one of them has to walk down that list.
+	enum order
+	{
+		RANDOM,
+		SORTED,
+		REVERSE_SORTED,
+		ADVERSARIAL
+	};
+
+	// Constructs a generator of numberOfWords words drawn from a vocabulary of vocabularySize
+	// distinct words. The word of rank r (starting at one) is drawn with probability proportional
+	// to 1 / r^zipfExponent, and each word is between minLength and maxLength characters long.
+	// The same seed always generates the same corpus.
+	CorpusGenerator(unsigned long long numberOfWords, unsigned int vocabularySize, double zipfExponent,
+		int minLength, int maxLength, order wordOrder, unsigned long long seed);
+	~CorpusGenerator();
+
+	bool nextWord(char word[50]); // Copies the next word of the corpus into the given buffer
+	void rewind(); // Starts the corpus over from its first word, without making up the vocabulary again
+
+	void describe(); // Prints out the parameters of the corpus
+
+	// Sets wordOrder to the order with the given name (random, sorted, reverse or adversarial), returning false if there isn't one.
+	static bool parseOrder(const char* name, order& wordOrder);
+private:
+	void buildVocabulary(); // Makes up every word of the vocabulary and sorts them alphabetically
+	void buildDistribution(); // Calculates the Zipf distribution over the ranks, and the number of copies of each word for the sorted orders
+
+	unsigned int drawRank(); // Returns the rank of a randomly drawn word
+
+	const char* wordOfRank(unsigned int rank); // Returns the word with the given rank
+
+	unsigned long long numberOfWords;	// The number of words in the corpus
+	unsigned int vocabularySize;		// The number of distinct words the corpus is drawn from
+	double zipfExponent;				// The exponent of the Zipf distribution, where 0 is uniform and bigger is more skewed
+	int minLength;						// The shortest a word can be
+	int maxLength;						// The longest a word can be
+	order wordOrder;					// The order the words come in
+	unsigned long long seed;			// The seed we generate everything from
+
+	mt19937_64 generator;				// The random number generator for drawing words
+
+	char* wordData = nullptr;						// Every word of the vocabulary, one after another, each ending in a zero
+	unsigned long long* wordOffsets = nullptr;		// Where the word of each rank starts in wordData
+	unsigned int* alphabetical = nullptr;			// The ranks of the words in alphabetical order
+	double* cumulativeProbability = nullptr;		// The probability of drawing a word of each rank or any rank before it
+	unsigned long long* copies = nullptr;			// The number of copies of each word in the sorted orders
+
+	unsigned long long wordsGenerated = 0;			// The number of words we have handed out so far
+	unsigned long long copiesLeft = 0;				// The number of copies of the current word still to hand out in the sorted orders
+	unsigned int position = 0;						// How far through the alphabetical order we are in the sorted orders
+	unsigned int currentRank = 0;					// The rank of the word we are handing out copies of in the sorted orders
+};
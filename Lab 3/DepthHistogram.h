@@ -0,0 +1,121 @@
+//==============================================================================================
+// File: DepthHistogram.h - Access depth histogram
+//
+// The key comparison counters only give us a total, which hides how the work is spread out:
+// a tree that keeps the words we look for most often near the root does fewer comparisons
+// than its height suggests, and an unbalanced tree (or a skip list with unlucky towers) can
+// have a long tail of slow accesses behind a reasonable average. To see that, the datatypes
+// record the depth of every insert and lookup (the number of nodes looked at to find the word,
+// or to find where it goes) in one of these, which keeps a count per depth and prints them as
+// a histogram. Like the other statistics, recording does nothing when the counters are compiled out.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Statistics.h"
+#include "WordQuery.h"
+
+using namespace std;
+
+class DepthHistogram
+{
+public:
+	void record(size_t depth) // Counts one access at the given depth
+	{
+		if (!statisticsEnabled()) // Without statistics, this is compiled down to nothing.
+		{
+			return;
+		}
+
+		if (depth >= counts.size())
+		{
+			counts.resize(depth + 1, 0);
+		}
+
+		counts[depth]++;
+		accesses++;
+		totalDepth += depth;
+	}
+
+	unsigned long long getAccesses() const { return accesses; } // Returns the number of accesses recorded
+	double getAverageDepth() const { return accesses > 0 ? (double)totalDepth / accesses : 0; } // Returns the average depth of an access
+
+	void display(const char* title) const
+	{
+		// This method prints the average depth and a bar for each depth, scaled so that the
+		// most common depth gets a full bar. Deep trees can have hundreds of depths, so once
+		// there are more than MAX_ROWS of them, each row adds up a range of depths.
+		//
+		const size_t MAX_ROWS = 40;
+		const size_t BAR_WIDTH = 40;
+
+		cout << title << ": " << accesses << " accesses, average depth " << getAverageDepth() << "\n";
+
+		if (accesses == 0)
+		{
+			return;
+		}
+
+		size_t rowWidth = (counts.size() + MAX_ROWS - 1) / MAX_ROWS; // The number of depths each row adds up
+		vector<unsigned long long> rows((counts.size() + rowWidth - 1) / rowWidth, 0);
+		unsigned long long largest = 0;
+
+		for (size_t depth = 0; depth < counts.size(); depth++)
+		{
+			rows[depth / rowWidth] += counts[depth];
+		}
+
+		for (unsigned long long row : rows)
+		{
+			largest = row > largest ? row : largest;
+		}
+
+		for (size_t r = 0; r < rows.size(); r++)
+		{
+			if (rows[r] == 0) // We skip depths nothing was found at, like depth 0 (the root is at depth 1) and gaps in the tail.
+			{
+				continue;
+			}
+
+			cout << "  ";
+
+			if (rowWidth == 1)
+			{
+				cout << r;
+			}
+			else
+			{
+				cout << r * rowWidth << "-" << (r + 1) * rowWidth - 1;
+			}
+
+			cout << ": " << rows[r] << " (" << 100.0 * rows[r] / accesses << "%) " << string((size_t)(BAR_WIDTH * rows[r] / largest), '#') << "\n";
+		}
+	}
+private:
+	vector<unsigned long long> counts;	// The number of accesses at each depth
+	unsigned long long accesses = 0;	// The number of accesses recorded
+	unsigned long long totalDepth = 0;	// The sum of the depths of every access, for the average
+};
+
+// Prints the depth each of the given words is at right now, which shows where a datatype keeps
+// the words that are looked for the most. depthOf is called with each word and returns its depth.
+template <class DepthOf>
+void displayWordDepths(const char* title, const vector<WordCount>& words, DepthOf depthOf)
+{
+	cout << title << ":";
+
+	for (size_t i = 0; i < words.size(); i++)
+	{
+		cout << (i == 0 ? " " : ", ") << words[i].word << " " << depthOf(words[i].word);
+	}
+
+	cout << "\n";
+}
@@ -0,0 +1,152 @@
+//==============================================================================================
+// File: EytzingerIndex.cpp - Sorted array in Eytzinger order with branchless search
+// c.f.: EytzingerIndex.h
+//
+// This is the simplest read-only index we could think of, which makes it the baseline the
+// pointer-based datatypes have to beat once we are only looking words up. The words are a
+// sorted array, but instead of keeping them in alphabetical order, we store them the way a
+// heap is stored (which is called Eytzinger order): the middle word is in slot 1 and the
+// children of slot k are in slots 2k and 2k + 1. A binary search then always goes from slot
+// k to slot 2k or 2k + 1, so:
+//
+//  - the next slot is computed with arithmetic instead of chosen with a branch, so there is
+//    nothing for the processor to mispredict, and
+//  - the 8 slots three levels below slot k are next to each other (slots 8k to 8k + 7), so one
+//    prefetch fetches the whole level we will reach three steps from now.
+//
+// Like the frozen tree, we compare the packed first eight bytes of the words, and only compare
+// whole words when those are the same.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "EytzingerIndex.h"
+
+// The prefixes of one cache line worth of slots. Eight 8 byte prefixes make up a 64 byte line,
+// so this is also how far ahead (three levels, 2 * 2 * 2 slots) we prefetch.
+const size_t PREFIXES_PER_LINE = 8;
+
+void EytzingerIndex::build(const vector<WordCount>& sortedWords)
+{
+	// This method sizes our arrays, lines the prefixes up with a cache line, and places the words.
+	//
+	size = sortedWords.size();
+
+	// We allocate a cache line more than we need so that we can start the prefixes on a 64 byte boundary.
+	prefixStorage.assign(size + 1 + PREFIXES_PER_LINE, 0);
+	size_t misalignment = ((size_t)prefixStorage.data() / sizeof(unsigned long long)) % PREFIXES_PER_LINE;
+	prefixes = prefixStorage.data() + (misalignment == 0 ? 0 : PREFIXES_PER_LINE - misalignment);
+
+	counts.assign(size + 1, 0);
+	wordOffsets.assign(size + 1, 0);
+
+	vector<size_t> offsets(size); // Where each word starts in the words array, in alphabetical order
+
+	for (size_t i = 0; i < size; i++)
+	{
+		offsets[i] = words.size();
+		words.insert(words.end(), sortedWords[i].word, sortedWords[i].word + strlen(sortedWords[i].word) + 1);
+	}
+
+	size_t next = 0;
+
+	place(1, sortedWords, next, offsets);
+}
+
+void EytzingerIndex::place(size_t k, const vector<WordCount>& sortedWords, size_t& next, vector<size_t>& offsets)
+{
+	// An in-order walk of the implicit tree visits the slots in alphabetical order, so we
+	// hand out the sorted words in the order we visit the slots.
+	//
+	if (k > size)
+	{
+		return;
+	}
+
+	place(2 * k, sortedWords, next, offsets);
+
+	prefixes[k] = packPrefix(sortedWords[next].word);
+	counts[k] = sortedWords[next].count;
+	wordOffsets[k] = offsets[next];
+	next++;
+
+	place(2 * k + 1, sortedWords, next, offsets);
+}
+
+unsigned int EytzingerIndex::find(const char word[50])
+{
+	// This method finds the first slot whose word isn't less than ours. At each slot we go to
+	// 2k if the slot's word isn't less than ours and 2k + 1 if it is, which is just k = 2k + less.
+	// Once we fall off the bottom, k is the slot we stopped at followed by a 1 for every time we
+	// went right after the last time we went left, so shifting those off (and the 0 of that left
+	// turn) gives us the last slot we went left at, which is the answer. If we never went left,
+	// every word is less than ours and k becomes zero.
+	//
+	unsigned long long prefix = packPrefix(word);
+	size_t k = 1;
+
+	numberOfLookups++;
+
+	while (k <= size)
+	{
+		size_t ahead = k * PREFIXES_PER_LINE;
+
+		if (ahead <= size) // We start loading the slots three levels down, as long as they exist.
+		{
+			prefetch(prefixes + ahead);
+		}
+
+		numberOfPrefixComparisons++;
+
+		size_t less;
+
+		if (prefixes[k] != prefix) // Almost every step is decided by the prefixes,
+		{
+			less = prefixes[k] < prefix;
+		}
+		else // and only when they are the same do we look at the whole words, which is rare enough to predict well.
+		{
+			numberOfFullComparisons++;
+
+			less = strcmp(&words[wordOffsets[k]], word) < 0;
+		}
+
+		k = 2 * k + less;
+	}
+
+	k >>= countTrailingZeros(~(unsigned long long)k) + 1;
+
+	if (k == 0 || prefixes[k] != prefix) // If we fell off the right end or the prefix is different, the word isn't here.
+	{
+		return 0;
+	}
+
+	numberOfFullComparisons++;
+
+	return strcmp(&words[wordOffsets[k]], word) == 0 ? counts[k] : 0;
+}
+
+unsigned long long EytzingerIndex::getKeyComparisons()
+{
+	return numberOfPrefixComparisons + numberOfFullComparisons;
+}
+
+unsigned long long EytzingerIndex::getMemoryUsage()
+{
+	return (size + 1) * (sizeof(unsigned long long) + sizeof(unsigned int) + sizeof(size_t)) + words.size();
+}
+
+void EytzingerIndex::displayStatistics()
+{
+	// This method displays statistics about the index and the lookups performed on it.
+	//
+	cout << "Eytzinger Index Stats:\n"; // Print out a header specifying that these are Eytzinger index stats
+	cout << "Distinct Words: " << size << "\n"; // Print out the number of words in the index
+	cout << "Bytes: " << getMemoryUsage() << "\n"; // Print out the bytes taken up by the index
+	cout << "Lookups: " << numberOfLookups << "\n"; // Print out the number of lookups performed
+	cout << "Prefix Comparisons: " << numberOfPrefixComparisons << "\n"; // Print out the number of prefix comparisons
+	cout << "Full Comparisons: " << numberOfFullComparisons << "\n"; // Print out the number of times whole words had to be compared
+}
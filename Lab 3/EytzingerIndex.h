@@ -0,0 +1,66 @@
+//==============================================================================================
+// File: EytzingerIndex.h - Sorted array in Eytzinger order with branchless search
+// Header for EytzingerIndex.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include "Statistics.h"
+#include "Prefetch.h"
+#include "Bits.h"
+#include "WordQuery.h"
+
+using namespace std;
+
+class EytzingerIndex
+{
+public:
+	// Builds an index out of any range of words in alphabetical order with no duplicates, such
+	// as what words() returns for each of our datatypes.
+	template <class Range>
+	EytzingerIndex(const Range& sortedWords)
+	{
+		vector<WordCount> copy;
+
+		for (WordCount w : sortedWords)
+		{
+			copy.push_back(w);
+		}
+
+		build(copy);
+	}
+
+	unsigned int find(const char word[50]); // Returns the number of times the word was inserted, or zero if it isn't in the index
+	void displayStatistics(); // Displays statistics about the index and the lookups performed
+	unsigned long long getKeyComparisons(); // Returns the number of prefix and whole word comparisons made so far
+	unsigned long long getMemoryUsage(); // Returns the number of bytes the index takes up
+private:
+	void build(const vector<WordCount>& sortedWords); // Fills in every array from the sorted words
+
+	// Places the sorted words, starting at next, into the subtree rooted at slot k by an in-order walk
+	void place(size_t k, const vector<WordCount>& sortedWords, size_t& next, vector<size_t>& offsets);
+
+	// The slots of the index are numbered from 1, the children of slot k are slots 2k and 2k + 1,
+	// and each slot's prefix, count and word are kept in their own arrays, so that the searches
+	// only ever touch the prefixes until they are done. Slot 0 is unused.
+	size_t size = 0;						// The number of words in the index
+	vector<unsigned long long> prefixStorage;	// Holds the prefixes, with room to line them up with the cache
+	unsigned long long* prefixes = nullptr;	// The packed first eight bytes of each slot's word, with slot 0 on a cache line boundary
+	vector<unsigned int> counts;			// The count of each slot's word
+	vector<size_t> wordOffsets;				// Where each slot's word starts in the words array
+	vector<char> words;						// Every word, one after another, each ending in a zero
+
+	statistic numberOfLookups = 0;				// Keeps track of the number of lookups performed.
+	statistic numberOfPrefixComparisons = 0;	// Keeps track of the number of times we compared a word against a slot's prefix.
+	statistic numberOfFullComparisons = 0;		// Keeps track of the number of times the prefixes matched and we had to compare whole words.
+};
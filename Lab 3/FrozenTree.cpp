@@ -0,0 +1,194 @@
+//==============================================================================================
+// File: FrozenTree.cpp - Read-only tree in van Emde Boas layout implementation
+// c.f.: FrozenTree.h
+//
+// Once we are done inserting words, the trees are only read, but their nodes are still
+// scattered across the heap wherever new put them, so every step of a lookup is likely a
+// cache miss. A frozen tree is a copy of a tree that can't change anymore, which lets us
+// lay it out for reading:
+//
+//  - Every node lives in one array and refers to its children by index, which takes half
+//    the space of a pointer, so a node is 24 bytes and almost three fit in a cache line.
+//  - Each node keeps the first eight bytes of its word packed into a number, so most
+//    comparisons are a single integer comparison that doesn't leave the node. Only when
+//    the prefixes are equal do we compare the whole words, which are kept in their own array.
+//  - The tree is perfectly balanced, and its nodes are in van Emde Boas order: we split the
+//    tree at half its height into a top tree and the bottom trees hanging off of it, store
+//    the top tree first and then each bottom tree, and lay out each of those the same way.
+//    Whatever the size of a cache line (or a page), a lookup then goes through a few small
+//    chunks of the tree that are each stored together, instead of a new line at every level.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "FrozenTree.h"
+
+FrozenTree::FrozenTree(const vector<WordCount>& sortedWords)
+{
+	// constructor -- we copy every word into our words array, work out where each word's
+	// node goes in the van Emde Boas order, and then fill in the nodes.
+	//
+	size_t n = sortedWords.size();
+	vector<uint32_t> offsets(n); // Where each word starts in the words array, in alphabetical order
+
+	for (size_t i = 0; i < n; i++)
+	{
+		offsets[i] = (uint32_t)words.size();
+		words.insert(words.end(), sortedWords[i].word, sortedWords[i].word + strlen(sortedWords[i].word) + 1);
+	}
+
+	while (((size_t)1 << height) - 1 < n) // A perfectly balanced tree of n nodes has the fewest levels that hold n nodes.
+	{
+		height++;
+	}
+
+	vector<uint32_t> position(n);	// The index in the nodes array of each word's node, in alphabetical order
+	uint32_t next = 0;				// The next free index in the nodes array
+
+	layout(0, n, height, position, next);
+
+	nodes.resize(n);
+
+	for (size_t i = 0; i < n; i++) // Each node gets its word's prefix, count and offset,
+	{
+		node& p = nodes[position[i]];
+
+		p.prefix = packPrefix(sortedWords[i].word);
+		p.count = sortedWords[i].count;
+		p.wordOffset = offsets[i];
+	}
+
+	link(0, n, position); // and then its children.
+}
+
+void FrozenTree::layout(size_t lo, size_t hi, int levels, vector<uint32_t>& position, uint32_t& next)
+{
+	// This method places the nodes of the top levels levels of the balanced tree over the
+	// sorted words [lo, hi). The root of a range is its middle word. One level is just the
+	// root. Otherwise, we split the levels in half: we place the top half (which is a tree
+	// of its own), then each bottom tree hanging off of it, from left to right.
+	//
+	if (lo >= hi || levels == 0)
+	{
+		return;
+	}
+
+	if (levels == 1)
+	{
+		position[lo + (hi - lo) / 2] = next++;
+
+		return;
+	}
+
+	int top = levels / 2;
+
+	layout(lo, hi, top, position, next);
+	layoutSubtrees(lo, hi, top, levels - top, position, next);
+}
+
+void FrozenTree::layoutSubtrees(size_t lo, size_t hi, int depth, int levels, vector<uint32_t>& position, uint32_t& next)
+{
+	// This method finds the subtrees whose roots are depth levels below the root of [lo, hi),
+	// from left to right, and lays out the top levels levels of each one.
+	//
+	if (lo >= hi)
+	{
+		return;
+	}
+
+	if (depth == 0)
+	{
+		layout(lo, hi, levels, position, next);
+
+		return;
+	}
+
+	size_t mid = lo + (hi - lo) / 2;
+
+	layoutSubtrees(lo, mid, depth - 1, levels, position, next);
+	layoutSubtrees(mid + 1, hi, depth - 1, levels, position, next);
+}
+
+uint32_t FrozenTree::link(size_t lo, size_t hi, const vector<uint32_t>& position)
+{
+	// The root of [lo, hi) is its middle word, its left subtree is the words before it, and
+	// its right subtree is the words after it. We fill in the children's indices on our way
+	// back up and return the root's index.
+	//
+	if (lo >= hi)
+	{
+		return NONE;
+	}
+
+	size_t mid = lo + (hi - lo) / 2;
+	node& p = nodes[position[mid]];
+
+	p.leftChild = link(lo, mid, position);
+	p.rightChild = link(mid + 1, hi, position);
+
+	return position[mid];
+}
+
+unsigned int FrozenTree::find(const char word[50])
+{
+	// This method walks down the tree from the root (which is always the first node) looking
+	// for the word. We pack the word's prefix once, and only compare whole words when a node's
+	// prefix matches ours.
+	//
+	uint64_t prefix = packPrefix(word);
+	uint32_t i = nodes.empty() ? NONE : 0;
+
+	numberOfLookups++;
+
+	while (i != NONE) // While we haven't fallen off of the tree,
+	{
+		const node& p = nodes[i];
+
+		numberOfNodesVisited++;
+		numberOfPrefixComparisons++;
+
+		if (prefix != p.prefix) // If the prefixes are different, they decide which way we go.
+		{
+			i = prefix < p.prefix ? p.leftChild : p.rightChild;
+
+			continue;
+		}
+
+		numberOfFullComparisons++;
+
+		int compareValue = strcmp(word, &words[p.wordOffset]); // Otherwise, we need the whole words.
+
+		if (compareValue == 0) // If they are the same, we found it!
+		{
+			return p.count;
+		}
+
+		i = compareValue < 0 ? p.leftChild : p.rightChild;
+	}
+
+	return 0;
+}
+
+unsigned long long FrozenTree::getMemoryUsage()
+{
+	return nodes.size() * sizeof(node) + words.size();
+}
+
+void FrozenTree::displayStatistics()
+{
+	// This method displays statistics about the layout of the tree and the lookups performed on it.
+	//
+	cout << "Frozen Tree Stats:\n"; // Print out a header specifying that these are frozen tree stats
+	cout << "Distinct Words: " << nodes.size() << "\n"; // Print out the number of nodes
+	cout << "Height: " << height << "\n"; // Print out the height of the balanced tree
+	cout << "Node Size: " << sizeof(node) << " bytes\n"; // Print out how big a single node is
+	cout << "Node Bytes: " << nodes.size() * sizeof(node) << "\n"; // Print out the bytes taken up by the nodes
+	cout << "Word Bytes: " << words.size() << "\n"; // Print out the bytes taken up by the words
+	cout << "Lookups: " << numberOfLookups << "\n"; // Print out the number of lookups performed
+	cout << "Nodes Visited: " << numberOfNodesVisited << "\n"; // Print out the number of nodes looked at
+	cout << "Prefix Comparisons: " << numberOfPrefixComparisons << "\n"; // Print out the number of prefix comparisons
+	cout << "Full Comparisons: " << numberOfFullComparisons << "\n"; // Print out the number of times whole words had to be compared
+}
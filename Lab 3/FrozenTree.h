@@ -0,0 +1,63 @@
+//==============================================================================================
+// File: FrozenTree.h - Read-only tree in van Emde Boas layout
+// Header for FrozenTree.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <cstring>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "Statistics.h"
+#include "WordQuery.h"
+
+using namespace std;
+
+class FrozenTree
+{
+public:
+	// Builds a frozen tree out of the given words, which have to be in alphabetical order
+	// with no duplicates, the way every datatype's words() returns them.
+	FrozenTree(const vector<WordCount>& sortedWords);
+
+	unsigned int find(const char word[50]); // Returns the number of times the word was inserted, or zero if it isn't in the tree
+	void displayStatistics(); // Displays statistics about the layout and the lookups performed
+	unsigned long long getMemoryUsage(); // Returns the number of bytes the nodes and words take up
+private:
+	static const uint32_t NONE = 0xFFFFFFFF; // The index of a child that doesn't exist
+
+	struct node
+	{
+		uint64_t prefix;		// The first eight bytes of the word, packed so that comparing prefixes compares words
+		uint32_t leftChild;		// The index of the left child in the nodes array, or NONE
+		uint32_t rightChild;	// The index of the right child in the nodes array, or NONE
+		uint32_t count;			// The amount of times the word was inserted
+		uint32_t wordOffset;	// Where the whole word starts in the words array
+	};
+
+	// Places the top levels of the balanced tree over sorted words [lo, hi) in van Emde Boas order
+	void layout(size_t lo, size_t hi, int levels, vector<uint32_t>& position, uint32_t& next);
+
+	// Calls layout on every subtree whose root is the given number of levels below the root of [lo, hi)
+	void layoutSubtrees(size_t lo, size_t hi, int depth, int levels, vector<uint32_t>& position, uint32_t& next);
+
+	// Fills in the child indices of the subtree over [lo, hi), returning the index of its root
+	uint32_t link(size_t lo, size_t hi, const vector<uint32_t>& position);
+
+	vector<node> nodes;		// Every node, in van Emde Boas order, so the root is nodes[0]
+	vector<char> words;		// Every word, one after another, each ending in a zero
+	int height = 0;			// The number of levels in the tree
+
+	statistic numberOfLookups = 0;				// Keeps track of the number of lookups performed.
+	statistic numberOfNodesVisited = 0;			// Keeps track of the number of nodes looked at during lookups.
+	statistic numberOfPrefixComparisons = 0;	// Keeps track of the number of times we compared a word against a node's prefix.
+	statistic numberOfFullComparisons = 0;		// Keeps track of the number of times the prefixes matched and we had to compare whole words.
+};
@@ -0,0 +1,431 @@
+//==============================================================================================
+// File: HashTable.cpp - Open addressing hash table with SIMD metadata implementation
+// c.f.: HashTable.h
+//
+// Every other datatype in this program keeps its words in alphabetical order, which is what
+// lets them answer range, prefix and ordered queries. Most real word counters don't need any
+// of that and just use a hash table, so this table is here to show what keeping the words in
+// order costs. It only has what the passes need: insert, list (which sorts the words when it
+// is called) and the statistics.
+//
+// It is laid out like the "Swiss table" hash maps: the slots live in one array, and next to
+// them is an array with one control byte per slot, holding either EMPTY or 7 bits of the
+// slot's hash. The slots are split into groups of 16, and a word starts at the group its hash
+// picks and probes group after group until it finds an empty slot. With SSE2, we compare all
+// 16 control bytes of a group against the word's 7 bits at once, so most probes cost one
+// comparison and we almost never compare a word against a slot that holds a different word.
+// Each slot also keeps its word's whole hash, which we check before comparing words and reuse
+// when the table grows. We never delete, so an empty slot always ends a probe.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "HashTable.h"
+#include "Bits.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HASH_TABLE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// The number of slots a new table starts with.
+const size_t INITIAL_CAPACITY = 1024;
+
+HashTable::HashTable()
+{
+	// constructor -- we allocate our first slots and mark every one of them as empty.
+	//
+	capacity = INITIAL_CAPACITY;
+	control = new signed char[capacity];
+	entries = new entry[capacity];
+
+	memset(control, EMPTY, capacity);
+}
+
+HashTable::~HashTable()
+{
+	// On deconstruction, we delete our two arrays. The words are in the entries, so there is nothing else.
+	//
+	delete[] control;
+	delete[] entries;
+}
+
+unsigned long long HashTable::hashWord(const char* word)
+{
+	// This is the 64 bit FNV-1a hash followed by the final mixing step of MurmurHash3. FNV-1a
+	// is cheap for short words, but its high bits are poorly mixed, and we use both the low 7
+	// bits (for the control byte) and the high bits (for the group), so we mix it once more.
+	//
+	unsigned long long hash = 14695981039346656037ULL;
+
+	for (const char* p = word; *p != 0; p++)
+	{
+		hash ^= (unsigned char)*p;
+		hash *= 1099511628211ULL;
+	}
+
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53ULL;
+	hash ^= hash >> 33;
+
+	return hash;
+}
+
+unsigned int HashTable::matchByte(const signed char* group, signed char byte)
+{
+	// With SSE2, we load the whole group, compare every byte at once, and gather the top bit
+	// of each result into a mask. Without it, we do the same thing one byte at a time.
+	//
+#ifdef HASH_TABLE_SSE2
+	__m128i bytes = _mm_loadu_si128((const __m128i*)group);
+
+	return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(byte)));
+#else
+	unsigned int mask = 0;
+
+	for (size_t i = 0; i < GROUP_SIZE; i++)
+	{
+		mask |= (unsigned int)(group[i] == byte) << i;
+	}
+
+	return mask;
+#endif
+}
+
+void HashTable::insert(const char word[50])
+{
+	// This method looks for the word in the groups its hash leads to. If it finds it, the
+	// count goes up. If it finds an empty slot first, the word isn't in the table, so it goes
+	// in that slot (after growing the table, if it is getting too full).
+	//
+	unsigned long long hash = hashWord(word);
+	signed char tag = (signed char)(hash & 0x7F);	// The 7 bits of the hash that go in the control byte
+	size_t groupMask = capacity / GROUP_SIZE - 1;	// There is a power of two number of groups, so this wraps a group number around
+	size_t group = (size_t)(hash >> 7) & groupMask;	// The first group we look in, chosen by the bits the tag doesn't use
+	size_t groupsProbed = 0;						// The number of groups we have looked at, for our depth histogram
+
+	while (true) // An empty slot always ends the loop, since we never let the table fill up.
+	{
+		const signed char* groupControl = control + group * GROUP_SIZE;
+		unsigned int matches = matchByte(groupControl, tag);
+
+		numberOfGroupProbes++;
+		groupsProbed++;
+
+		while (matches != 0) // For every slot in this group with our tag,
+		{
+			entry& e = entries[group * GROUP_SIZE + countTrailingZeros(matches)];
+
+			numberOfTagMatches++;
+			numberOfHashComparisons++;
+
+			if (e.hash == hash) // if the whole hash matches,
+			{
+				numberOfKeyComparisonsMade++;
+
+				if (strcmp(e.word, word) == 0) // and so does the word, we found it,
+				{
+					e.count++; // and we count it.
+					insertDepths.record(groupsProbed);
+
+					return;
+				}
+			}
+
+			matches &= matches - 1; // Otherwise, we move on to the next matching slot.
+		}
+
+		if (matchByte(groupControl, EMPTY) != 0) // If this group has an empty slot, the word isn't in the table.
+		{
+			break;
+		}
+
+		group = (group + 1) & groupMask; // If the group is full, we move on to the next one.
+	}
+
+	insertDepths.record(groupsProbed);
+
+	// We keep the table at most 7/8 full, so that probes stay short. If this word would
+	// push us past that, we grow first, which means the empty slot we found has moved.
+	if ((numberOfEntries + 1) * 8 > capacity * 7)
+	{
+		grow();
+	}
+
+	size_t slot = findEmptySlot(hash);
+
+	control[slot] = tag;
+	entries[slot].hash = hash;
+	entries[slot].count = 1;
+	strcpy(entries[slot].word, word);
+
+	numberOfEntries++;
+}
+
+size_t HashTable::findEmptySlot(unsigned long long hash)
+{
+	// This method probes the same groups an insert of a word with this hash would, and
+	// returns the first empty slot it finds.
+	//
+	size_t groupMask = capacity / GROUP_SIZE - 1;
+	size_t group = (size_t)(hash >> 7) & groupMask;
+
+	while (true)
+	{
+		unsigned int empties = matchByte(control + group * GROUP_SIZE, EMPTY);
+
+		numberOfGroupProbes++;
+
+		if (empties != 0)
+		{
+			return group * GROUP_SIZE + countTrailingZeros(empties);
+		}
+
+		group = (group + 1) & groupMask;
+	}
+}
+
+void HashTable::grow()
+{
+	// This method doubles the number of slots and puts every entry into the new slots. Since
+	// every entry kept its hash, we never have to hash a word again to move it.
+	//
+	signed char* oldControl = control;
+	entry* oldEntries = entries;
+	size_t oldCapacity = capacity;
+
+	capacity *= 2;
+	control = new signed char[capacity];
+	entries = new entry[capacity];
+
+	memset(control, EMPTY, capacity);
+
+	for (size_t i = 0; i < oldCapacity; i++) // For every slot of the old table,
+	{
+		if (oldControl[i] != EMPTY) // if it has an entry, we move it over.
+		{
+			size_t slot = findEmptySlot(oldEntries[i].hash);
+
+			control[slot] = oldControl[i];
+			entries[slot] = oldEntries[i];
+
+			numberOfEntriesMoved++;
+		}
+	}
+
+	delete[] oldControl;
+	delete[] oldEntries;
+
+	numberOfGrowths++;
+}
+
+unsigned int HashTable::find(const char word[50])
+{
+	// This method probes for the word the same way insert does, returning its count if it finds it.
+	//
+	unsigned long long hash = hashWord(word);
+	signed char tag = (signed char)(hash & 0x7F);
+	size_t groupMask = capacity / GROUP_SIZE - 1;
+	size_t group = (size_t)(hash >> 7) & groupMask;
+	size_t groupsProbed = 0;
+
+	while (true)
+	{
+		const signed char* groupControl = control + group * GROUP_SIZE;
+		unsigned int matches = matchByte(groupControl, tag);
+
+		numberOfGroupProbes++;
+		groupsProbed++;
+
+		while (matches != 0)
+		{
+			entry& e = entries[group * GROUP_SIZE + countTrailingZeros(matches)];
+
+			numberOfTagMatches++;
+			numberOfHashComparisons++;
+
+			if (e.hash == hash)
+			{
+				numberOfKeyComparisonsMade++;
+
+				if (strcmp(e.word, word) == 0)
+				{
+					lookupDepths.record(groupsProbed);
+
+					return e.count;
+				}
+			}
+
+			matches &= matches - 1;
+		}
+
+		if (matchByte(groupControl, EMPTY) != 0) // An empty slot means the word would have been in this group.
+		{
+			lookupDepths.record(groupsProbed);
+
+			return 0;
+		}
+
+		group = (group + 1) & groupMask;
+	}
+}
+
+unsigned int HashTable::depthOf(const char* word) const
+{
+	// This method probes for the word like find does, counting groups instead of statistics.
+	//
+	unsigned long long hash = hashWord(word);
+	signed char tag = (signed char)(hash & 0x7F);
+	size_t groupMask = capacity / GROUP_SIZE - 1;
+	size_t group = (size_t)(hash >> 7) & groupMask;
+	unsigned int groupsProbed = 0;
+
+	while (true)
+	{
+		const signed char* groupControl = control + group * GROUP_SIZE;
+		unsigned int matches = matchByte(groupControl, tag);
+
+		groupsProbed++;
+
+		for (; matches != 0; matches &= matches - 1)
+		{
+			const entry& e = entries[group * GROUP_SIZE + countTrailingZeros(matches)];
+
+			if (e.hash == hash && strcmp(e.word, word) == 0)
+			{
+				return groupsProbed;
+			}
+		}
+
+		if (matchByte(groupControl, EMPTY) != 0)
+		{
+			return 0;
+		}
+
+		group = (group + 1) & groupMask;
+	}
+}
+
+vector<WordCount> HashTable::words() const
+{
+	// The table has no order of its own, so we gather every entry and sort them by their words.
+	//
+	vector<WordCount> result;
+
+	result.reserve(numberOfEntries);
+
+	for (size_t i = 0; i < capacity; i++)
+	{
+		if (control[i] != EMPTY)
+		{
+			result.push_back({ entries[i].word, entries[i].count });
+		}
+	}
+
+	sort(result.begin(), result.end(), [](const WordCount& a, const WordCount& b) { return strcmp(a.word, b.word) < 0; });
+
+	return result;
+}
+
+void HashTable::list()
+{
+	// This method prints out every word in the table in the same indexed list the other
+	// datatypes print, which means sorting the words first.
+	//
+	vector<WordCount> sortedWords = words();
+
+	if (sortedWords.empty()) // If there are no words, we just say so.
+	{
+		cout << "Set is empty" << endl;
+
+		return;
+	}
+
+	cout << "Set contains: ";
+
+	for (size_t i = 0; i < sortedWords.size(); i++)
+	{
+		if (i != 0) // Every word after the first is separated from the one before it by a comma.
+		{
+			cout << ", ";
+		}
+
+		cout << "(" << i + 1 << ") " << sortedWords[i].word << " " << sortedWords[i].count;
+	}
+
+	cout << endl;
+}
+
+const DepthHistogram& HashTable::getLookupDepths() const
+{
+	return lookupDepths;
+}
+
+unsigned long long HashTable::getKeyComparisons()
+{
+	return numberOfKeyComparisonsMade;
+}
+
+unsigned long long HashTable::getMemoryUsage()
+{
+	// Unlike the trees, we pay for every slot, full or empty, and a control byte for each.
+	//
+	return capacity * (sizeof(entry) + sizeof(signed char));
+}
+
+unsigned long long HashTable::getAllocatedBytes()
+{
+	return MemoryUsage::allocatedSize(control) + MemoryUsage::allocatedSize(entries);
+}
+
+void HashTable::displayStatistics()
+{
+	// This method displays statistics related to the number of words in the table and the
+	// probing done as words are inserted.
+	//
+	unsigned long long numWords = 0; // We add up the counts of every entry to get the total number of words.
+
+	for (size_t i = 0; i < capacity; i++)
+	{
+		if (control[i] != EMPTY)
+		{
+			numWords += entries[i].count;
+		}
+	}
+
+	unsigned long long liveBytes = getMemoryUsage(); // We also find out how much memory the slots take up,
+	unsigned long long allocatedBytes = getAllocatedBytes(); // and how much the allocator really set aside for them.
+
+	cout << "Hash Table Stats:\n"; // Print out a header specifying that these are hash table stats
+	cout << "Distinct Words: " << numberOfEntries << "\n"; // Print out the total number of unique words
+	cout << "Total Words: " << numWords << "\n"; // Print out the total number of words
+	cout << "Slots: " << capacity << "\n"; // Print out the number of slots
+	cout << "Load Factor: " << (double)numberOfEntries / capacity << "\n"; // Print out how full the table is
+	cout << "Slot Size: " << sizeof(entry) + sizeof(signed char) << " bytes\n"; // Print out how big a single slot and its control byte are
+	cout << "Live Bytes: " << liveBytes << "\n"; // Print out the number of bytes the slots take up
+	cout << "Allocated Bytes: " << allocatedBytes << "\n"; // Print out the number of bytes the allocator set aside for them
+	cout << "Allocator Overhead: " << (allocatedBytes > liveBytes ? allocatedBytes - liveBytes : 0) << " bytes\n"; // Print out how much of that is rounding
+	cout << "Bytes per Distinct Word: " << (numberOfEntries > 0 ? (double)allocatedBytes / numberOfEntries : 0) << "\n"; // Print out what each distinct word costs
+	cout << "SIMD Metadata: " <<
+#ifdef HASH_TABLE_SSE2
+		"SSE2"
+#else
+		"none (scalar)"
+#endif
+		<< "\n"; // Print out whether groups are matched with SSE2
+	cout << "Group Probes: " << numberOfGroupProbes << "\n"; // Print out the number of groups looked at
+	cout << "Tag Matches: " << numberOfTagMatches << "\n"; // Print out the number of slots whose control byte matched
+	cout << "Hash Comparisons: " << numberOfHashComparisons << "\n"; // Print out the number of full hash comparisons
+	cout << "Key Comparisons: " << numberOfKeyComparisonsMade << "\n"; // Print out the number of whole word comparisons
+	cout << "Growths: " << numberOfGrowths << "\n"; // Print out the number of times the table doubled
+	cout << "Entries Moved: " << numberOfEntriesMoved << "\n"; // Print out the number of entries moved while growing
+	insertDepths.display("Insert Probe Lengths"); // Print out how many groups each insert probed
+
+	// Print out how many groups a search for each of the ten most frequent words probes.
+	displayWordDepths("Top Word Probe Lengths", selectTopK(words(), 10), [this](const char* word) { return depthOf(word); });
+}
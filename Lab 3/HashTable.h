@@ -0,0 +1,85 @@
+//==============================================================================================
+// File: HashTable.h - Open addressing hash table with SIMD metadata
+// Header for HashTable.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <iostream>
+#include <vector>
+#include "Statistics.h"
+#include "MemoryUsage.h"
+#include "WordQuery.h"
+#include "DepthHistogram.h"
+
+using namespace std;
+
+class HashTable
+{
+public:
+	HashTable();
+	~HashTable();
+
+	void insert(const char word[50]); // adds a word to the table
+	void list(); // Prints a list of all words in the table, sorting them first.
+	void displayStatistics(); // Displays statistics about the table operations performed.
+
+	// Returns the number of times the word has been inserted, or zero if it isn't in the table
+	unsigned int find(const char word[50]);
+
+	vector<WordCount> words() const; // Returns every word in the table, sorted into alphabetical order
+	unsigned long long getKeyComparisons(); // Returns the number of whole word comparisons made so far
+	unsigned long long getMemoryUsage(); // Returns the number of bytes taken up by the slots of the table
+	unsigned long long getAllocatedBytes(); // Returns the number of bytes the allocator set aside for the slots of the table
+	const DepthHistogram& getLookupDepths() const; // Returns the number of groups every find probed so far
+private:
+	// The slots of the table are split into groups of GROUP_SIZE, and each slot has a control
+	// byte, which is EMPTY or the low 7 bits of the hash of the word in the slot. The control
+	// bytes of a group are next to each other, so one SSE2 comparison checks a whole group.
+	static const size_t GROUP_SIZE = 16;
+	static const signed char EMPTY = -128;
+
+	struct entry
+	{
+		unsigned long long hash;	// The hash of the word, which we keep so that growing never rehashes a word
+		unsigned int count;			// The amount of times the word has been inserted into the table
+		char word[50];				// The word of the entry
+	};
+
+	static unsigned long long hashWord(const char* word); // Hashes a word, mixing every bit of it into every bit of the hash
+
+	// Returns a bit mask with bit i set if control byte i of the group at the given address equals the given byte
+	static unsigned int matchByte(const signed char* group, signed char byte);
+
+	// Returns the index of the slot a word with the given hash would go in, assuming the word isn't in the table
+	size_t findEmptySlot(unsigned long long hash);
+
+	// Returns the number of groups a search for the word probes, or zero if it isn't in the table.
+	// This doesn't count toward any statistics.
+	unsigned int depthOf(const char* word) const;
+
+	void grow(); // Doubles the number of slots, moving every entry over to the new slots
+
+	signed char* control = nullptr;	// The control byte of every slot
+	entry* entries = nullptr;		// The entry of every slot, which is only meaningful if its control byte isn't EMPTY
+	size_t capacity = 0;			// The number of slots, which is always a power of two and at least GROUP_SIZE
+	size_t numberOfEntries = 0;		// The number of slots in use, which is the number of distinct words
+
+	// A hash table has no depth, but the number of groups a search probes is what its depth would be.
+	DepthHistogram insertDepths; // How many groups each insert probed before finding its word or an empty slot
+	DepthHistogram lookupDepths; // How many groups each find probed
+
+	statistic numberOfGroupProbes = 0;			// Keeps track of the number of groups we looked at while inserting or finding words.
+	statistic numberOfTagMatches = 0;			// Keeps track of the number of slots whose control byte matched a word's hash.
+	statistic numberOfHashComparisons = 0;		// Keeps track of the number of times we compared a word's full hash against a slot's.
+	statistic numberOfKeyComparisonsMade = 0;	// Keeps track of the number of whole word comparisons made.
+	statistic numberOfGrowths = 0;				// Keeps track of the number of times the table doubled in size.
+	statistic numberOfEntriesMoved = 0;			// Keeps track of the number of entries moved while growing.
+};
@@ -0,0 +1,192 @@
+//==============================================================================================
+// File: IngestPool.cpp - A pool of file tokenizing threads implementation
+// c.f.: IngestPool.h
+//
+// Reading and tokenizing a file doesn't touch any datatype, so when the input is many files,
+// that work can be spread over several threads. Each worker takes the next file nobody has
+// taken yet, tokenizes it into batches of words, and pushes each full batch onto a bounded
+// queue. The thread that owns the datatype is the queue's only consumer, so the datatypes
+// themselves never see more than one thread and don't need any locking. Workers take whole
+// files, so the words of one file stay in order, but the files are interleaved in whatever
+// order the workers finish them.
+//
+// Instead of the queue, each worker can also count its words in a datatype of its own, which
+// takes the one inserting thread out of the picture at the cost of merging the datatypes at
+// the end. runLocal does that, handing each word straight to the worker's own datatype.
+//
+// For every file, we time how long it took from being picked up to having its last batch
+// queued. That includes any time the worker spent waiting for room in the queue, which is
+// what a file's words actually waited before they could be inserted.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "IngestPool.h"
+#include <algorithm>
+
+IngestPool::IngestPool(const InputFiles& files, int threads, bool foldCase, size_t queueCapacity)
+	: files(files), queue(queueCapacity), fileLatencies(files.size(), 0.0)
+{
+	// constructor -- we only remember how to do the work here. Nothing runs until start.
+	//
+	this->threads = threads < 1 ? 1 : threads;
+	this->foldCase = foldCase;
+}
+
+IngestPool::~IngestPool()
+{
+	// On deconstruction, we wait for every worker. If the consumer stopped taking batches
+	// early, the workers could be waiting for room forever, so we drain the queue as we go.
+	//
+	WordBatch* batch;
+
+	while (!workers.empty() && queue.pop(batch)) // (If we never started, nobody will ever close the queue.)
+	{
+		delete batch;
+	}
+
+	for (thread& worker : workers)
+	{
+		worker.join();
+	}
+}
+
+void IngestPool::start()
+{
+	runningWorkers = threads; // This has to be set before any worker can finish and count itself out.
+
+	for (int i = 0; i < threads; i++)
+	{
+		workers.push_back(thread(&IngestPool::work, this, i));
+	}
+}
+
+void IngestPool::runLocal(const function<void(int worker, const char* word)>& insert)
+{
+	insertLocal = insert; // With somewhere to put the words, the workers never touch the queue,
+
+	start();
+
+	for (thread& worker : workers) // so all we have to do is wait for them.
+	{
+		worker.join();
+	}
+
+	workers.clear(); // They have all been joined, so the destructor has nothing left to wait for.
+}
+
+WordBatch* IngestPool::next()
+{
+	WordBatch* batch;
+
+	return queue.pop(batch) ? batch : nullptr; // The queue is closed once the last worker finishes.
+}
+
+void IngestPool::release(WordBatch* batch)
+{
+	delete batch;
+}
+
+unsigned long long IngestPool::getTokens()
+{
+	return tokens;
+}
+
+void IngestPool::work(int worker)
+{
+	// This method is the loop each worker runs. We claim files by bumping nextFile, so every
+	// file is taken by exactly one worker, and stop once it runs past the end of the list.
+	//
+	while (true)
+	{
+		size_t index = nextFile++;
+
+		if (index >= files.size())
+		{
+			break;
+		}
+
+		chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+		Tokenizer tokenizer(files.path(index), foldCase);
+		WordBatch* batch = insertLocal ? nullptr : new WordBatch(); // We only need batches if we are queueing our words.
+		unsigned long long fileTokens = 0;
+
+		if (tokenizer.fail())
+		{
+			failedFiles++;
+		}
+
+		if (insertLocal) // If we count the words ourselves, each one goes straight into our datatype.
+		{
+			char word[50];
+
+			while (tokenizer.nextWord(word))
+			{
+				insertLocal(worker, word);
+				fileTokens++;
+			}
+		}
+
+		while (batch != nullptr && tokenizer.nextWord(batch->words[batch->count])) // For each word of the file, we fill up a batch,
+		{
+			if (++batch->count == WordBatch::CAPACITY) // and hand it over once it is full.
+			{
+				fileTokens += batch->count;
+				queue.push(batch);
+				batch = new WordBatch();
+			}
+		}
+
+		if (batch != nullptr && batch->count > 0) // The last batch of a file is usually only partly full.
+		{
+			fileTokens += batch->count;
+			queue.push(batch);
+		}
+		else
+		{
+			delete batch; // (which does nothing if we never had a batch)
+		}
+
+		tokens += fileTokens;
+		fileLatencies[index] = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+	}
+
+	if (--runningWorkers == 0) // The last worker out tells the consumer that nothing more is coming.
+	{
+		queue.close();
+	}
+}
+
+void IngestPool::displayStatistics()
+{
+	// This method prints how long files took to tokenize. A median and a 99th percentile say
+	// more than an average here, since one huge file can take longer than all the rest put
+	// together. It is only called after every batch has been taken, so the workers are done
+	// writing their latencies (next returning nullptr means the last of them closed the queue).
+	//
+	vector<double> latencies = fileLatencies;
+
+	cout << "Tokenizing Threads: " << threads << "\n";
+	cout << "Files Tokenized: " << files.size() - failedFiles << " of " << files.size() << "\n";
+
+	if (!latencies.empty())
+	{
+		sort(latencies.begin(), latencies.end());
+
+		cout << "Per-File Latency: min " << latencies.front() * 1000 << " ms, median " << latencies[latencies.size() / 2] * 1000
+			<< " ms, p99 " << latencies[(latencies.size() - 1) * 99 / 100] * 1000 << " ms, max " << latencies.back() * 1000 << " ms\n";
+	}
+
+	if (insertLocal) // Without the queue, there was no waiting to report.
+	{
+		return;
+	}
+
+	// If the tokenizers often found the queue full, the datatype is the bottleneck and more
+	// threads won't help. If the datatype often found it empty, the tokenizers are behind.
+	cout << "Queue Full Waits (tokenizers waiting on the datatype): " << queue.getFullWaits() << "\n";
+	cout << "Queue Empty Waits (datatype waiting on the tokenizers): " << queue.getEmptyWaits() << "\n";
+}
@@ -0,0 +1,79 @@
+//==============================================================================================
+// File: IngestPool.h - A pool of file tokenizing threads
+// Header for IngestPool.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "BoundedQueue.h"
+#include "InputFiles.h"
+#include "Tokenizer.h"
+
+using namespace std;
+
+// A batch of words tokenized out of one file, handed from a worker to the inserting thread.
+struct WordBatch
+{
+	static const size_t CAPACITY = 1024; // The most words a batch holds
+
+	char words[CAPACITY][50];	// The words, each in the same 50 byte buffer the datatypes take
+	size_t count = 0;			// The number of words in the batch
+};
+
+class IngestPool
+{
+public:
+	// Sets up a pool that tokenizes the given files on the given number of worker threads. At
+	// most queueCapacity batches are waiting to be inserted at once. The files have to outlive the pool.
+	IngestPool(const InputFiles& files, int threads, bool foldCase = false, size_t queueCapacity = 64);
+	~IngestPool(); // Waits for the workers to finish
+
+	void start(); // Starts the workers
+
+	// Returns the next batch of words, waiting for one if none are ready, or nullptr once every
+	// file has been tokenized. Batches come from any file in any order. Each batch has to be
+	// given back with release once its words have been inserted.
+	WordBatch* next();
+	void release(WordBatch* batch);
+
+	// Tokenizes every file on the worker threads like start does, but instead of queueing the
+	// words, each worker hands them straight to insert along with its own number (from 0 up
+	// to the number of threads), so that each worker can count them in a datatype of its own.
+	// Returns once every file has been tokenized.
+	void runLocal(const function<void(int worker, const char* word)>& insert);
+
+	unsigned long long getTokens(); // Returns the number of words the workers have tokenized
+	void displayStatistics(); // Displays the per-file latencies and how often each side of the queue waited
+private:
+	void work(int worker); // The loop each worker runs, tokenizing files until there are none left
+
+	const InputFiles& files;			// The files we tokenize
+	int threads;						// The number of workers
+	bool foldCase;						// Whether or not the tokenizers lowercase each word
+
+	function<void(int, const char*)> insertLocal; // Where each worker puts its words when it counts them itself, or empty to queue them
+
+	vector<thread> workers;				// The worker threads
+	BoundedQueue<WordBatch*> queue;		// The batches waiting to be inserted
+	atomic<size_t> nextFile{ 0 };		// The index of the next file a worker should take
+	atomic<int> runningWorkers{ 0 };	// The number of workers that haven't finished yet; the last one closes the queue
+	atomic<unsigned long long> tokens{ 0 };		// The number of words tokenized so far
+	atomic<unsigned long long> failedFiles{ 0 };	// The number of files that couldn't be opened
+
+	// The seconds each file took from the moment a worker picked it up until its last batch
+	// was queued. Every file has its own slot, so the workers never write to the same one.
+	vector<double> fileLatencies;
+};
@@ -0,0 +1,257 @@
+//==============================================================================================
+// File: InputFiles.cpp - The list of input files implementation
+// c.f.: InputFiles.h
+//
+// A real corpus is usually thousands of files rather than one, so the driver collects every
+// path it is given in one of these. Each argument can name a file, a directory (whose files
+// are all read, going into subdirectories too), a wildcard pattern, or a list file. Patterns
+// are expanded here instead of by the shell, since the Windows command prompt doesn't expand
+// them and a shell can run out of room for the arguments of a large corpus. Directories and
+// patterns are expanded in sorted order, so every run reads the files in the same order.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "InputFiles.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace fs = std::filesystem;
+
+bool InputFiles::add(const char* argument)
+{
+	// This method works out what kind of argument it was given and adds its files. A plain path
+	// is added as it is, even if it doesn't exist, so that opening it fails in the same place
+	// (and with the same message) that it always has.
+	//
+	string text = argument;
+	error_code error;
+
+	if (text.length() > 1 && text[0] == '@') // @list names a file of more arguments,
+	{
+		return addList(text.substr(1));
+	}
+
+	if (text.find_first_of("*?") != string::npos) // a wildcard is a pattern,
+	{
+		return addPattern(text);
+	}
+
+	if (fs::is_directory(text, error)) // a directory stands for every file under it,
+	{
+		return addDirectory(text);
+	}
+
+	paths.push_back(text); // and anything else is a file.
+
+	return true;
+}
+
+bool InputFiles::empty() const
+{
+	return paths.empty();
+}
+
+size_t InputFiles::size() const
+{
+	return paths.size();
+}
+
+const char* InputFiles::path(size_t i) const
+{
+	return paths[i].c_str();
+}
+
+void InputFiles::describe() const
+{
+	// With one file, we print the same line that we always have. With more, we print how
+	// many there are and the first few, since listing thousands of them helps nobody.
+	//
+	if (paths.size() == 1)
+	{
+		cout << "File: " << paths[0] << "\n";
+
+		return;
+	}
+
+	cout << "Files: " << paths.size() << " (";
+
+	for (size_t i = 0; i < paths.size() && i < 3; i++)
+	{
+		cout << (i == 0 ? "" : ", ") << paths[i];
+	}
+
+	cout << (paths.size() > 3 ? ", ...)\n" : ")\n");
+}
+
+bool InputFiles::addDirectory(const string& directory)
+{
+	// This method adds every regular file under a directory. A directory iterator doesn't
+	// promise any order, so we sort what we find before adding it. Entries we can't read
+	// (like a subdirectory without permission) are skipped rather than stopping the walk.
+	//
+	vector<string> found;
+	error_code error;
+
+	for (fs::recursive_directory_iterator entry(directory, fs::directory_options::skip_permission_denied, error), end;
+		!error && entry != end; entry.increment(error))
+	{
+		if (entry->is_regular_file(error))
+		{
+			found.push_back(entry->path().string());
+		}
+	}
+
+	if (found.empty())
+	{
+		cout << "No files were found in " << directory << "\n";
+
+		return false;
+	}
+
+	sort(found.begin(), found.end());
+	paths.insert(paths.end(), found.begin(), found.end());
+
+	return true;
+}
+
+bool InputFiles::addPattern(const string& pattern)
+{
+	// This method adds every regular file whose name matches a pattern. Only the last part of
+	// the pattern can have wildcards in it (corpus/*.txt, but not */chapter1.txt), so we list
+	// the directory before it and match each name against the rest.
+	//
+	size_t slash = pattern.find_last_of("/\\");
+	string directory = slash == string::npos ? "." : pattern.substr(0, slash + 1);
+	string namePattern = slash == string::npos ? pattern : pattern.substr(slash + 1);
+	vector<string> found;
+	error_code error;
+
+	if (directory.find_first_of("*?") != string::npos)
+	{
+		cout << "Only the last part of " << pattern << " can have wildcards in it\n";
+
+		return false;
+	}
+
+	for (fs::directory_iterator entry(directory, error), end; !error && entry != end; entry.increment(error))
+	{
+		if (entry->is_regular_file(error) && matches(namePattern.c_str(), entry->path().filename().string().c_str()))
+		{
+			// We keep the directory the way it was written, so ./ doesn't show up in front of every file.
+			found.push_back(slash == string::npos ? entry->path().filename().string() : directory + entry->path().filename().string());
+		}
+	}
+
+	if (found.empty())
+	{
+		cout << "No files match " << pattern << "\n";
+
+		return false;
+	}
+
+	sort(found.begin(), found.end());
+	paths.insert(paths.end(), found.begin(), found.end());
+
+	return true;
+}
+
+bool InputFiles::addList(const string& listPath)
+{
+	// This method adds the argument on each line of a list file. Blank lines are skipped,
+	// and a carriage return is taken off the end of each line, in case the list was written
+	// on Windows. A line can be a directory, a pattern or even another list, but not a list
+	// we are already in the middle of adding, since that would go around in circles forever.
+	//
+	ifstream listFile(listPath);
+	string line;
+
+	if (!listFile.is_open())
+	{
+		cout << "Unable to open list file " << listPath << "\n";
+
+		return false;
+	}
+
+	error_code error;
+	string canonicalPath = fs::canonical(listPath, error).string(); // The same list can be named many ways, so we compare canonical paths.
+
+	if (error)
+	{
+		canonicalPath = listPath;
+	}
+
+	if (!listsBeingAdded.insert(canonicalPath).second)
+	{
+		cout << "List file " << listPath << " leads back to itself\n";
+
+		return false;
+	}
+
+	bool added = true;
+
+	while (added && getline(listFile, line))
+	{
+		if (!line.empty() && line.back() == '\r')
+		{
+			line.pop_back();
+		}
+
+		if (!line.empty())
+		{
+			added = add(line.c_str());
+		}
+	}
+
+	listsBeingAdded.erase(canonicalPath); // Once we are done with it, another list can name it again.
+
+	return added;
+}
+
+bool InputFiles::matches(const char* pattern, const char* name)
+{
+	// This method matches a name against a pattern where ? matches any one character and *
+	// matches any run of characters (including none). We go through both strings together,
+	// and when we hit a *, we remember where it was. If the rest of the pattern stops matching
+	// later on, we go back and let that * swallow one more character of the name, which only
+	// ever moves forward, so this takes O(pattern * name) time at worst with no recursion.
+	//
+	const char* star = nullptr;	// The last * we saw in the pattern, if we saw one
+	const char* resume = nullptr;	// Where the name picks up again if we have to go back to that *
+
+	while (*name != 0)
+	{
+		if (*pattern == '*') // A * starts out matching nothing.
+		{
+			star = pattern++;
+			resume = name;
+		}
+		else if (*pattern == '?' || *pattern == *name) // A ? or the same character matches one character.
+		{
+			pattern++;
+			name++;
+		}
+		else if (star != nullptr) // If we don't match, the last * takes one more character.
+		{
+			pattern = star + 1;
+			name = ++resume;
+		}
+		else // Without a * to fall back on, the name doesn't match.
+		{
+			return false;
+		}
+	}
+
+	while (*pattern == '*') // Once the name runs out, only *s can be left in the pattern.
+	{
+		pattern++;
+	}
+
+	return *pattern == 0;
+}
@@ -0,0 +1,45 @@
+//==============================================================================================
+// File: InputFiles.h - The list of input files
+// Header for InputFiles.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <set>
+#include <string>
+#include <vector>
+#include <iostream>
+
+using namespace std;
+
+class InputFiles
+{
+public:
+	// Adds the files named by a command line argument, which can be a file, a directory (every
+	// file under it), a pattern with * and ? in its last part (like corpus/*.txt), or @list for
+	// a file that names one argument of any of those kinds per line. Returns false, after saying
+	// why, if a directory, pattern or list didn't lead to any files.
+	bool add(const char* argument);
+
+	bool empty() const; // Returns true if no files have been added
+	size_t size() const; // Returns the number of files
+	const char* path(size_t i) const; // Returns the path of the ith file
+
+	void describe() const; // Prints out how many files there are, and the first few of them
+private:
+	bool addDirectory(const string& directory); // Adds every regular file under a directory, in sorted order
+	bool addPattern(const string& pattern); // Adds every regular file matching a wildcard pattern, in sorted order
+	bool addList(const string& listPath); // Adds the argument on each line of a list file, refusing lists that name themselves
+
+	static bool matches(const char* pattern, const char* name); // Returns true if name matches the wildcard pattern
+
+	vector<string> paths; // The path of every file, in the order they were added
+	set<string> listsBeingAdded; // The canonical path of every list we are in the middle of adding, to catch lists that lead back to themselves
+};
@@ -15,90 +15,1770 @@
 
 #include <iostream>
 #include <fstream>
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <type_traits>
 
+#include "ART.h"
 #include "AVL.h"
 #include "BST.h"
+#include "CorpusGenerator.h"
+#include "EytzingerIndex.h"
+#include "HashTable.h"
+#include "IngestPool.h"
+#include "InputFiles.h"
+#include "MemoryUsage.h"
+#include "MergeTree.h"
+#include "MultiFileSource.h"
+#include "PerfCounters.h"
+#include "PersistentAVL.h"
 #include "RBT.h"
+#include "ScalingReport.h"
 #include "SkipList.h"
+#include "SplayTree.h"
+#include "Tokenizer.h"
+#include "Treap.h"
 
 using namespace std;
 
-void runTests(char* file_path)
+struct options
+{
+	InputFiles inputs;				// The input files, from every path, directory, pattern and @list we were given
+	bool measureHardware = false;	// Whether or not we read the hardware performance counters during each pass (-perf)
+
+	unsigned long long seed = 0;		// The seed of the skip list's level generator (-seed), the current time by default
+	double promotionProbability = 0.5;	// The probability a skip list node is promoted to the next lane (-promote)
+	int maxLevel = 32;					// The tallest a skip list tower can be (-maxlevel)
+
+	char* rangeLow = nullptr;	// The low end of a range query to run on each datatype (-range <lo> <hi>)
+	char* rangeHigh = nullptr;	// The high end of that range query
+	char* prefix = nullptr;		// A prefix query to run on each datatype (-prefix <pre>)
+	char* rankWord = nullptr;	// A word to find the alphabetical rank of in each datatype (-rank <word>)
+	unsigned long long pageFirst = 0;	// The place of the first word of a page of words to list from each datatype, counting from one (-page <first> <count>)
+	unsigned long long pageCount = 0;	// The number of words on that page, or 0 to not list a page
+	char* cursorWord = nullptr;			// The word a cursor query starts after in each datatype (-after <word> <count>)
+	unsigned long long cursorCount = 0;	// The number of words the cursor query takes, or 0 to not run one
+	unsigned long long exportPageSize = 0;	// The number of words per page when timing a paged export of each datatype (-export <n>), or 0 to not time one
+
+	bool benchmarkTopK = false;	// Whether or not we time top K queries on each datatype (-topk)
+
+	bool benchmarkMixed = false; // Whether or not we time a mixed insert, decrement and remove workload on each datatype (-mixed)
+
+	unsigned long long windowSize = 0; // The number of most recent words each datatype counts in sliding window mode (-window <n>), or 0 for no window
+
+	bool foldCase = false; // Whether or not every word is lowercased as it is read (-fold)
+
+	unsigned long long generatedWords = 0;	// The number of words to generate instead of reading a file (-generate <n>), or 0 to read the file
+	unsigned int vocabularySize = 100000;	// The number of distinct words in a generated corpus (-vocab <n>)
+	double zipfExponent = 1.0;				// How skewed the word frequencies of a generated corpus are (-zipf <s>)
+	int minLength = 3;						// The shortest a generated word can be (-length <min> <max>)
+	int maxLength = 10;						// The longest a generated word can be
+	CorpusGenerator::order wordOrder = CorpusGenerator::RANDOM; // The order of the generated words (-order <random|sorted|reverse|adversarial>)
+	char* outputPath = nullptr;				// A file to write the generated corpus to instead of running any passes (-out <path>)
+
+	unsigned long long scalingMaxWords = 0;	// The largest corpus in the scaling benchmark (-scaling <n>), or 0 to not run it
+	char* csvPath = nullptr;				// A file to write the scaling benchmark's results to, instead of printing them (-csv <path>)
+
+	unsigned long long lookups = 0;			// The number of lookups to time on each tree (-lookup <n>), or 0 to not time any
+	bool prefetch = false;					// Whether or not the trees prefetch both children on the way down during the insert passes (-prefetch)
+
+	bool validate = false;					// Whether or not we check every invariant of the ordered datatypes after their insert passes (-validate)
+	unsigned long long fuzzOperations = 0;	// The number of random operations in the stress test (-fuzz <n>), or 0 to not run it
+
+	int threads = 0; // The number of threads that tokenize the input files for each datatype (-threads <n>), or 0 to run the usual passes
+	bool localTrees = false; // Whether each tokenizing thread counts its words in a datatype of its own, merged at the end (-local)
+
+	int persistentReaders = -1;				// The number of reader threads querying the persistent AVL tree while it is built (-persistent <n>), or -1 to not run it
+	unsigned long long publishBatch = 1024;	// The number of inserts between the persistent AVL tree's published versions (-batch <n>)
+
+	int concurrentReaders = 0;				// The most reader threads to time against the balanced trees while they are written to (-concurrent <n>), or 0 to not run it
+	unsigned long long writeRate = 100000;	// The number of changes per second the writer makes during the concurrent reads (-writes <n>)
+};
+
+WordSource* openWordSource(options& opts)
+{
+	// This method returns the words every pass reads: a generated corpus if we were asked
+	// for one, or otherwise the words of the input files, one file after another. Each call
+	// starts from the first word again, and since the generator is seeded, every pass gets
+	// exactly the same words.
+	//
+	if (opts.generatedWords > 0)
+	{
+		return new CorpusGenerator(opts.generatedWords, opts.vocabularySize, opts.zipfExponent,
+			opts.minLength, opts.maxLength, opts.wordOrder, opts.seed);
+	}
+
+	if (opts.inputs.size() == 1) // A single file is read the way it always has been.
+	{
+		return new Tokenizer(opts.inputs.path(0), opts.foldCase);
+	}
+
+	return new MultiFileSource(opts.inputs, opts.foldCase);
+}
+
+void writeCorpus(options& opts)
+{
+	// This method writes a generated corpus to a file, so that it can be read back in later
+	// (or by another program). The words are separated by spaces with sixteen to a line.
+	//
+	WordSource* source = openWordSource(opts);
+	ofstream outFile(opts.outputPath, ios::binary);
+	char word[50];
+	unsigned long long i = 0;
+
+	if (outFile.fail())
+	{
+		cout << "Unable to open output file\n";
+
+		delete source;
+
+		return;
+	}
+
+	while (source->nextWord(word)) // For each word of the corpus,
+	{
+		outFile << word << (++i % 16 == 0 ? '\n' : ' '); // we write it out, ending every sixteenth word's line.
+	}
+
+	outFile << '\n';
+
+	cout << "Wrote " << i << " words to " << opts.outputPath << "\n";
+
+	delete source;
+}
+
+// The mixed workload remembers the last HISTORY words it read. Once it has read that many,
+// every fourth word it decrements the word it read HISTORY words ago, and every other fourth
+// word it removes that word entirely, so half of the words read are followed by a deletion.
+const int HISTORY = 1024;
+
+template <class Range>
+void printQueryResults(const char* description, Range results, unsigned long long firstIndex = 1)
+{
+	// This method prints the results of a range or prefix query in the same
+	// format that list() uses, numbering each word starting at one (or at the
+	// place of the first word, for a page out of the middle of the list).
+	//
+	cout << description << ": ";
+
+	unsigned long long index = firstIndex - 1;
+
+	for (WordCount w : results) // For each word the query found,
+	{
+		if (index != firstIndex - 1) // we separate it from the one before it,
+		{
+			cout << ", ";
+		}
+
+		cout << "(" << ++index << ") " << w.word << " " << w.count; // and print its index, word and count.
+	}
+
+	if (index == firstIndex - 1) // If the query didn't find anything, we say so.
+	{
+		cout << "no words";
+	}
+
+	cout << "\n";
+}
+
+template <class Datatype>
+void runRankQueries(Datatype* structure, options& opts)
+{
+	// This method answers the rank and page queries we were given on the command line. The
+	// datatypes that do keep the size of each subtree (or the width of each skip list node)
+	// find a word by its place in the list without walking there from the first word.
+	//
+	if (opts.rankWord != nullptr)
+	{
+		size_t rank = structure->rank(opts.rankWord);
+		WordCount w = structure->select(rank);
+
+		if (w.word != nullptr && strcmp(w.word, opts.rankWord) == 0) // If the word is there, rank is its index,
+		{
+			cout << "Rank Query: " << opts.rankWord << " is word " << rank + 1 << "\n";
+		}
+		else // and otherwise it is the number of words before where it would be.
+		{
+			cout << "Rank Query: " << opts.rankWord << " isn't there, but " << rank << " words come before it\n";
+		}
+	}
+
+	if (opts.pageCount > 0 && opts.pageFirst > 0)
+	{
+		printQueryResults("Page", structure->page(opts.pageFirst - 1, opts.pageCount), opts.pageFirst);
+	}
+}
+
+// The BST doesn't keep the size of its subtrees, since without balancing, keeping them up to
+// date would cost as much as the unbalanced paths do already, so it can't answer these.
+void runRankQueries(BST*, options& opts)
+{
+	if (opts.rankWord != nullptr || opts.pageCount > 0)
+	{
+		cout << "Rank and page queries aren't supported by the BST\n";
+	}
+}
+
+template <class Datatype>
+void runQueries(Datatype* structure, options& opts)
+{
+	// This method runs the range and prefix queries we were given on the
+	// command line against a datatype that has finished its pass.
+	//
+	if (opts.rangeLow != nullptr)
+	{
+		printQueryResults("Range Query", structure->rangeQuery(opts.rangeLow, opts.rangeHigh));
+	}
+
+	if (opts.prefix != nullptr)
+	{
+		printQueryResults("Prefix Query", structure->prefixQuery(opts.prefix));
+	}
+
+	runRankQueries(structure, opts);
+
+	if (opts.cursorCount > 0) // A cursor query copies out the words after the given one.
+	{
+		WordCursor cursor(opts.cursorWord);
+		vector<WordEntry> page((size_t)opts.cursorCount);
+		vector<WordCount> results;
+
+		size_t filled = structure->nextPage(cursor, page.data(), page.size());
+
+		for (size_t i = 0; i < filled; i++)
+		{
+			results.push_back({ page[i].word, page[i].count });
+		}
+
+		printQueryResults("Cursor Query", results);
+	}
+
+	if (opts.exportPageSize > 0)
+	{
+		// We time exporting every word a page at a time, the way a job that writes out the whole
+		// vocabulary would. Each page finds its start from the cursor's word alone.
+		WordCursor cursor;
+		vector<WordEntry> page((size_t)opts.exportPageSize);
+		unsigned long long words = 0;
+		unsigned long long pages = 0;
+		size_t filled;
+
+		chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+		while ((filled = structure->nextPage(cursor, page.data(), page.size())) > 0)
+		{
+			words += filled;
+			pages++;
+		}
+
+		chrono::duration<double> elapsedTime = chrono::steady_clock::now() - startTime;
+
+		cout << "Paged Export: " << words << " words in " << pages << " pages of " << opts.exportPageSize
+			<< " in " << elapsedTime.count() << " seconds\n";
+	}
+
+	if (opts.benchmarkTopK)
+	{
+		// We time the top K query for a small, medium and large k. The clock we use for
+		// the passes is too coarse for a single query, so we use the steady clock here.
+		size_t sizes[] = { 10, 1000, 100000 };
+
+		for (size_t k : sizes)
+		{
+			chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+			vector<WordCount> top = structure->topK(k);
+
+			chrono::duration<double> elapsedTime = chrono::steady_clock::now() - startTime;
+
+			cout << "Top " << k << " Query: " << top.size() << " words in " << elapsedTime.count() << " seconds\n";
+
+			if (k == 10) // We also print the ten most frequent words, since they are interesting to see.
+			{
+				printQueryResults("Top 10 Words", top);
+			}
+		}
+	}
+}
+
+template <class Datatype>
+clock_t runMixedPass(Datatype* structure, options& opts, unsigned long long& operations, unsigned long long& missedDeletes)
+{
+	// This method reads every word of the file, inserting it into the given datatype and
+	// decrementing or removing the word from HISTORY words ago as described above. If the
+	// datatype is nullptr, we do all of the same reading and copying without touching a
+	// datatype, which is our dry run. It returns the time the pass took and sets operations
+	// to the number of inserts, decrements and removes performed. A decrement or remove of
+	// a word that is already gone doesn't change anything, so it isn't an operation; those
+	// are counted in missedDeletes instead.
+	//
+	static char history[HISTORY][50];	// A ring buffer of the last HISTORY words we read
+	char word[50];
+	unsigned long long i = 0;			// The number of words we have read so far
+
+	operations = 0;
+	missedDeletes = 0;
+
+	WordSource* source = openWordSource(opts);
+
+	clock_t startTime = clock();
+
+	while (source->nextWord(word)) // For each word in the file,
+	{
+		char* oldWord = history[i % HISTORY]; // this is the slot of the word from HISTORY words ago.
+
+		if (structure != nullptr) // If we have a datatype,
+		{
+			structure->insert(word); // we insert the word,
+			operations++;
+
+			bool deleted = false;
+
+			if (i >= HISTORY && i % 4 == 1)			// then either decrement the old word,
+			{
+				deleted = structure->decrement(oldWord);
+			}
+			else if (i >= HISTORY && i % 4 == 3)	// or remove it.
+			{
+				deleted = structure->remove(oldWord);
+			}
+
+			if (deleted)
+			{
+				operations++;
+			}
+			else if (i >= HISTORY && i % 2 == 1) // The old word was already gone.
+			{
+				missedDeletes++;
+			}
+		}
+
+		strcpy(oldWord, word); // The word we just read takes the old word's slot.
+		i++;
+	}
+
+	clock_t elapsedTime = clock() - startTime;
+
+	delete source;
+
+	return elapsedTime;
+}
+
+template <class Datatype>
+void runMixedTest(const char* name, Datatype* structure, options& opts, clock_t dryRunElapsedTime)
+{
+	// This method runs a mixed pass on a datatype and prints its statistics, which now
+	// include the deletion counters, and its throughput with the dry run taken out.
+	//
+	unsigned long long operations;
+	unsigned long long missedDeletes;
+
+	clock_t elapsedTime = runMixedPass(structure, opts, operations, missedDeletes);
+
+	cout << "Mixed Insert/Delete Pass (" << name << "):\n";
+
+	structure->displayStatistics();
+
+	double seconds = (elapsedTime - dryRunElapsedTime) / (double)CLOCKS_PER_SEC;
+
+	cout << "Operations: " << operations << "\n";
+	cout << "Deletes of Missing Words: " << missedDeletes << " (not counted as operations)\n";
+	cout << "Elapsed Time: " << seconds << " seconds\n";
+
+	if (seconds > 0)
+	{
+		cout << "Throughput: " << operations / seconds << " operations per second\n";
+	}
+
+	delete structure;
+}
+
+void runMixedTests(options& opts)
+{
+	// This method times the mixed workload on a fresh copy of each datatype. Just like
+	// runTests, we start with a dry run so that reading the file isn't part of the time.
+	//
+	unsigned long long operations;
+	unsigned long long missedDeletes;
+
+	clock_t dryRunElapsedTime = runMixedPass<BST>(nullptr, opts, operations, missedDeletes);
+
+	runMixedTest("RBT", new RBT(), opts, dryRunElapsedTime);
+	runMixedTest("AVL", new AVL(), opts, dryRunElapsedTime);
+	runMixedTest("BST", new BST(), opts, dryRunElapsedTime);
+	runMixedTest("Skip List", new SkipList(opts.seed, opts.promotionProbability, opts.maxLevel), opts, dryRunElapsedTime);
+}
+
+struct windowResults
+{
+	unsigned long long words = 0;		// The number of words read from the file
+	unsigned long long windows = 0;		// The number of complete windows of words that went by
+	double slowestWindow = 0;			// The longest a single window took, in seconds
+	double fastestWindow = 0;			// The shortest a single window took, in seconds
+	clock_t elapsedTime = 0;			// The time the whole pass took
+};
+
+template <class Datatype>
+windowResults runWindowPass(Datatype* structure, options& opts)
+{
+	// This method counts the words of the file over a sliding window of the last windowSize
+	// words. Each word that arrives is inserted, and once the window is full, the word that
+	// falls out of the window (the one read windowSize words ago) is decremented, so the
+	// datatype always holds exactly the counts of the words in the window. We keep the
+	// window in a ring buffer, where the slot the new word goes into is the slot of the word
+	// that is expiring. Every windowSize words, we time how long that window took. If the
+	// datatype is nullptr, we do the same reading and copying without it as a dry run.
+	//
+	unsigned long long windowSize = opts.windowSize;	// The number of words in the window (-window <n>)
+	char(*recent)[50] = new char[windowSize][50];		// The ring buffer of the words in the window
+	char word[50];
+	windowResults results;
+
+	WordSource* source = openWordSource(opts);
+
+	clock_t startTime = clock();
+	chrono::steady_clock::time_point windowStartTime = chrono::steady_clock::now(); // clock() is too coarse to time one window
+
+	while (source->nextWord(word)) // For each word in the file,
+	{
+		char* slot = recent[results.words % windowSize]; // this is the slot of the word that is expiring.
+
+		if (structure != nullptr) // If we have a datatype,
+		{
+			structure->insert(word); // the new word is counted,
+
+			if (results.words >= windowSize) // and once the window is full,
+			{
+				structure->decrement(slot); // the expiring word isn't anymore.
+			}
+		}
+
+		strcpy(slot, word); // The new word takes the expiring word's slot.
+		results.words++;
+
+		if (results.words % windowSize == 0) // If we have finished a window, we time it.
+		{
+			chrono::steady_clock::time_point now = chrono::steady_clock::now();
+			double seconds = chrono::duration<double>(now - windowStartTime).count();
+
+			if (results.windows == 0 || seconds > results.slowestWindow)
+			{
+				results.slowestWindow = seconds;
+			}
+
+			if (results.windows == 0 || seconds < results.fastestWindow)
+			{
+				results.fastestWindow = seconds;
+			}
+
+			results.windows++;
+			windowStartTime = now;
+		}
+	}
+
+	results.elapsedTime = clock() - startTime;
+
+	delete source;
+	delete[] recent;
+
+	return results;
+}
+
+template <class Datatype>
+void runWindowTest(const char* name, Datatype* structure, options& opts, clock_t dryRunElapsedTime)
+{
+	// This method runs a sliding window pass on a datatype and prints its statistics, which
+	// describe the words in the last window, and the throughput of the pass. The per window
+	// throughputs include reading the file, since we can't take a dry run out of one window.
+	//
+	windowResults results = runWindowPass(structure, opts);
+
+	cout << "Sliding Window Pass (" << name << ", last " << opts.windowSize << " words):\n";
+
+	structure->displayStatistics();
+
+	double seconds = (results.elapsedTime - dryRunElapsedTime) / (double)CLOCKS_PER_SEC;
+
+	cout << "Words Read: " << results.words << "\n";
+	cout << "Elapsed Time: " << seconds << " seconds\n";
+
+	if (seconds > 0)
+	{
+		cout << "Throughput: " << results.words / seconds << " words per second\n";
+	}
+
+	if (results.windows > 0) // If at least one window went by, we print how fast the slowest and fastest ones were.
+	{
+		cout << "Windows: " << results.windows << "\n";
+		cout << "Slowest Window: " << opts.windowSize / results.slowestWindow << " words per second (including file reading)\n";
+		cout << "Fastest Window: " << opts.windowSize / results.fastestWindow << " words per second (including file reading)\n";
+	}
+
+	delete structure;
+}
+
+void runWindowTests(options& opts)
+{
+	// This method times the sliding window workload on a fresh copy of each datatype,
+	// starting with a dry run so that reading the file isn't part of the time.
+	//
+	clock_t dryRunElapsedTime = runWindowPass<BST>(nullptr, opts).elapsedTime;
+
+	runWindowTest("RBT", new RBT(), opts, dryRunElapsedTime);
+	runWindowTest("AVL", new AVL(), opts, dryRunElapsedTime);
+	runWindowTest("BST", new BST(), opts, dryRunElapsedTime);
+	runWindowTest("Skip List", new SkipList(opts.seed, opts.promotionProbability, opts.maxLevel), opts, dryRunElapsedTime);
+}
+
+template <class Datatype>
+void runScalingTest(const char* name, Datatype* structure, CorpusGenerator& corpus, unsigned long long size, double dryRunSeconds, ScalingReport& report)
+{
+	// This method inserts every word of the corpus into the datatype and adds how long that
+	// took (minus the dry run), along with the datatype's counters, to the report.
+	//
+	char word[50];
+
+	corpus.rewind(); // Every datatype gets exactly the same words.
+
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now(); // clock() is too coarse for the small sizes
+
+	while (corpus.nextWord(word))
+	{
+		structure->insert(word);
+	}
+
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count() - dryRunSeconds;
+
+	ScalingReport::measurement m;
+
+	m.datatype = name;
+	m.size = size;
+	m.seconds = seconds > 0 ? seconds : 0; // The dry run can be a little slower than a tiny pass.
+	m.keyComparisons = structure->getKeyComparisons();
+	m.referenceChanges = structure->getReferenceChanges();
+	m.height = structure->getHeight();
+	m.memory = structure->getMemoryUsage();
+
+	report.add(m);
+
+	delete structure;
+}
+
+void runScalingTests(options& opts)
+{
+	// This method runs every datatype over generated corpora of 1024 words, 4096 words,
+	// and so on, growing by four times each step until the next size would be bigger than
+	// the largest size we were given. The vocabulary of each corpus is as big as the corpus,
+	// so the number of distinct words (and the size of each datatype) grows along with it.
+	// The other corpus options (-zipf, -length, -order and -seed) apply to every size.
+	//
+	ScalingReport report;
+
+	for (unsigned long long size = 1024; size <= opts.scalingMaxWords; size *= 4)
+	{
+		unsigned int vocabulary = size < 0xFFFFFFFFULL ? (unsigned int)size : 0xFFFFFFFFU;
+
+		CorpusGenerator corpus(size, vocabulary, opts.zipfExponent, opts.minLength, opts.maxLength, opts.wordOrder, opts.seed);
+
+		cout << "Running " << size << " words...\n";
+
+		// Just like the other passes, we time reading the words without inserting them first.
+		char word[50];
+
+		chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+		while (corpus.nextWord(word))
+		{
+		}
+
+		double dryRunSeconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+
+		runScalingTest("RBT", new RBT(), corpus, size, dryRunSeconds, report);
+		runScalingTest("AVL", new AVL(), corpus, size, dryRunSeconds, report);
+		runScalingTest("BST", new BST(), corpus, size, dryRunSeconds, report);
+		runScalingTest("Skip List", new SkipList(opts.seed, opts.promotionProbability, opts.maxLevel), corpus, size, dryRunSeconds, report);
+	}
+
+	if (opts.csvPath != nullptr) // We write the raw numbers to the file we were given,
+	{
+		ofstream csvFile(opts.csvPath);
+
+		report.printCsv(csvFile);
+
+		cout << "Wrote results to " << opts.csvPath << "\n";
+	}
+	else // or print them out if we weren't given one.
+	{
+		report.printCsv(cout);
+	}
+
+	report.printFits();
+	report.plot(false);
+	report.plot(true);
+}
+
+// The lookup benchmark freezes the trees that know how to freeze themselves. A plain binary
+// search tree has no frozen form, so it gets nothing.
+FrozenTree* freezeForLookups(RBT* structure) { return structure->freeze(); }
+FrozenTree* freezeForLookups(AVL* structure) { return structure->freeze(); }
+FrozenTree* freezeForLookups(BST*) { return nullptr; }
+
+template <class Datatype>
+void runLookupTest(const char* name, Datatype* structure, options& opts)
+{
+	// This method fills a tree with the words of our input, then times looking up randomly
+	// chosen words from it three ways: one at a time, one at a time while prefetching both
+	// children of every node, and in interleaved groups with prefetching. Trees that can be
+	// frozen are then timed a fourth way, through their frozen copy, and last we time an
+	// Eytzinger index built from the tree's words, which is the baseline every tree should
+	// beat. Each way looks up the same words, so we also check that they all found the same counts.
+	//
+	char word[50];
+	WordSource* source = openWordSource(opts);
+
+	while (source->nextWord(word)) // We fill the tree first, which we don't time.
+	{
+		structure->insert(word);
+	}
+
+	delete source;
+
+	vector<const char*> distinctWords; // Every word in the tree, which the lookups are chosen from
+
+	for (WordCount w : structure->words())
+	{
+		distinctWords.push_back(w.word);
+	}
+
+	if (distinctWords.empty())
+	{
+		delete structure;
+
+		return;
+	}
+
+	mt19937_64 generator(opts.seed); // We choose the lookups with a seeded generator so every tree looks up the same words.
+	uniform_int_distribution<size_t> distribution(0, distinctWords.size() - 1);
+	vector<const char*> queries((size_t)opts.lookups);
+	vector<unsigned int> counts((size_t)opts.lookups);
+
+	for (const char*& query : queries)
+	{
+		query = distinctWords[distribution(generator)];
+	}
+
+	cout << "Lookup Benchmark (" << name << ", " << opts.lookups << " lookups over " << distinctWords.size()
+		<< " distinct words, " << structure->getMemoryUsage() << " bytes of nodes):\n";
+
+	const char* modeNames[] = { "Plain Lookups", "Prefetching Lookups", "Batched Prefetching Lookups" };
+	unsigned long long checksums[3] = {};
+
+	for (int mode = 0; mode < 3; mode++)
+	{
+		structure->setPrefetching(mode != 0);
+
+		chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+		if (mode == 2) // The batched lookups do every query in one call,
+		{
+			structure->findBatch(queries.data(), queries.size(), counts.data());
+		}
+		else // and the others do them one at a time.
+		{
+			for (size_t i = 0; i < queries.size(); i++)
+			{
+				counts[i] = structure->find(queries[i]);
+			}
+		}
+
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+
+		for (unsigned int count : counts) // We add up every count we found, so that we can compare the modes.
+		{
+			checksums[mode] += count;
+		}
+
+		cout << modeNames[mode] << ": " << (seconds > 0 ? queries.size() / seconds : 0) << " lookups per second\n";
+	}
+
+	structure->setPrefetching(false);
+
+	// Every mode looked up the same words, so this shows each lookup's depth three times over.
+	structure->getLookupDepths().display("Lookup Depths");
+
+	FrozenTree* frozen = freezeForLookups(structure);
+
+	if (frozen != nullptr) // If the tree can be frozen, we time its frozen copy too, without the time it took to freeze.
+	{
+		unsigned long long frozenChecksum = 0;
+		chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+		for (size_t i = 0; i < queries.size(); i++)
+		{
+			counts[i] = frozen->find(queries[i]);
+		}
+
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+
+		for (unsigned int count : counts)
+		{
+			frozenChecksum += count;
+		}
+
+		cout << "Frozen Lookups: " << (seconds > 0 ? queries.size() / seconds : 0) << " lookups per second ("
+			<< frozen->getMemoryUsage() << " bytes)\n";
+
+		if (frozenChecksum != checksums[0])
+		{
+			cout << "Frozen lookup results don't match!\n";
+		}
+
+		// Its own counters show how few nodes each lookup visits, and how many of them were
+		// settled by the packed prefix alone, without ever reading the word out of line.
+		frozen->displayStatistics();
+
+		delete frozen;
+	}
+
+	EytzingerIndex* index = new EytzingerIndex(structure->words());
+	unsigned long long indexChecksum = 0;
+	chrono::steady_clock::time_point indexStartTime = chrono::steady_clock::now();
+
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		counts[i] = index->find(queries[i]);
+	}
+
+	double indexSeconds = chrono::duration<double>(chrono::steady_clock::now() - indexStartTime).count();
+
+	for (unsigned int count : counts)
+	{
+		indexChecksum += count;
+	}
+
+	cout << "Eytzinger Index Lookups: " << (indexSeconds > 0 ? queries.size() / indexSeconds : 0) << " lookups per second ("
+		<< index->getMemoryUsage() << " bytes, " << (double)index->getKeyComparisons() / queries.size() << " comparisons per lookup)\n";
+
+	if (indexChecksum != checksums[0])
+	{
+		cout << "Eytzinger index lookup results don't match!\n";
+	}
+
+	index->displayStatistics(); // Its own counters show how many comparisons the packed prefixes settled.
+
+	delete index;
+
+	if (checksums[0] != checksums[1] || checksums[0] != checksums[2])
+	{
+		cout << "Lookup results don't match!\n";
+	}
+
+	delete structure;
+}
+
+void runLookupTests(options& opts)
+{
+	// This method runs the lookup benchmark on a fresh copy of each tree. For the trees to
+	// be bigger than the last level cache, the input needs a lot of distinct words, which
+	// the corpus generator can make (for example, -generate 20000000 -vocab 5000000).
+	//
+	runLookupTest("RBT", new RBT(), opts);
+	runLookupTest("AVL", new AVL(), opts);
+	runLookupTest("BST", new BST(), opts);
+}
+
+template <class Datatype>
+void runParallelTest(const char* name, Datatype* structure, options& opts)
+{
+	// This method inserts every word of the input files into a datatype, with the files
+	// tokenized by a pool of worker threads. This thread is the only one that touches the
+	// datatype: it takes batches of words off the pool's queue and inserts them as they
+	// come. Since several threads are working at once, we time the pass with a wall clock
+	// instead of clock(), which adds up the processor time of every thread.
+	//
+	IngestPool pool(opts.inputs, opts.threads, opts.foldCase);
+	WordBatch* batch;
+
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+	pool.start();
+
+	while ((batch = pool.next()) != nullptr) // For each batch the workers hand us,
+	{
+		for (size_t i = 0; i < batch->count; i++) // we insert each of its words,
+		{
+			structure->insert(batch->words[i]);
+		}
+
+		pool.release(batch); // and give the batch back.
+	}
+
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+
+	cout << "Parallel Ingestion (" << name << "):\n";
+
+	structure->displayStatistics();
+
+	cout << "Elapsed Time: " << seconds << " seconds (wall clock, including tokenizing)\n";
+
+	if (seconds > 0)
+	{
+		cout << "Throughput: " << pool.getTokens() / seconds << " words per second\n";
+	}
+
+	pool.displayStatistics();
+
+	cout << "\n";
+
+	delete structure;
+}
+
+template <class Datatype>
+void runLocalTreesTest(const char* name, vector<Datatype*> structures, options& opts)
+{
+	// This method is the other way to ingest files in parallel: each worker thread inserts
+	// the words of its files into a datatype of its own, so there is no queue and no single
+	// inserting thread to wait on. Once every file is done, the datatypes are merged in
+	// parallel rounds into one, which is the price we pay for that.
+	//
+	IngestPool pool(opts.inputs, (int)structures.size(), opts.foldCase);
+
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+	pool.runLocal([&structures](int worker, const char* word) { structures[worker]->insert(word); });
+
+	chrono::steady_clock::time_point mergeTime = chrono::steady_clock::now();
+
+	Datatype* structure = mergeAll(structures, (int)structures.size());
+
+	chrono::steady_clock::time_point endTime = chrono::steady_clock::now();
+	double seconds = chrono::duration<double>(endTime - startTime).count();
+
+	cout << "Parallel Ingestion (" << name << ", " << structures.size() << " local datatypes merged at the end):\n";
+
+	structure->displayStatistics(); // The counters are the first worker's inserts plus the merges.
+
+	cout << "Elapsed Time: " << seconds << " seconds (wall clock, including tokenizing)\n";
+	cout << "Merge Time: " << chrono::duration<double>(endTime - mergeTime).count() << " seconds\n";
+
+	if (seconds > 0)
+	{
+		cout << "Throughput: " << pool.getTokens() / seconds << " words per second\n";
+	}
+
+	pool.displayStatistics();
+
+	cout << "\n";
+
+	delete structure;
+}
+
+void runParallelTests(options& opts)
+{
+	// This method runs the parallel ingestion pass on a fresh copy of each datatype, in
+	// the same order as the usual passes. There is no dry run here, since the tokenizing
+	// happens alongside the inserts instead of before them, so it can't be taken back out.
+	//
+	opts.inputs.describe();
+
+	if (opts.localTrees) // With local datatypes, only the ones that can merge take part.
+	{
+		vector<RBT*> RBTs;
+		vector<AVL*> AVLs;
+		vector<BST*> BSTs;
+		vector<SkipList*> SLs;
+
+		for (int i = 0; i < opts.threads; i++)
+		{
+			RBTs.push_back(new RBT());
+			AVLs.push_back(new AVL());
+			BSTs.push_back(new BST());
+			SLs.push_back(new SkipList(opts.seed + i, opts.promotionProbability, opts.maxLevel)); // (so their towers aren't all the same)
+		}
+
+		runLocalTreesTest("RBT", RBTs, opts);
+		runLocalTreesTest("AVL", AVLs, opts);
+		runLocalTreesTest("BST", BSTs, opts);
+		runLocalTreesTest("Skip List", SLs, opts);
+
+		return;
+	}
+
+	runParallelTest("RBT", new RBT(), opts);
+	runParallelTest("AVL", new AVL(), opts);
+	runParallelTest("BST", new BST(), opts);
+	runParallelTest("Skip List", new SkipList(opts.seed, opts.promotionProbability, opts.maxLevel), opts);
+	runParallelTest("Splay Tree", new SplayTree(), opts);
+	runParallelTest("Treap", new Treap(opts.seed), opts);
+	runParallelTest("Adaptive Radix Tree", new ART(), opts);
+	runParallelTest("Hash Table", new HashTable(), opts);
+}
+
+// The number of distinct words the persistent AVL tree's readers look up over and over, taken from the start of the input.
+const size_t PERSISTENT_QUERY_WORDS = 1000;
+
+// How often (in lookups) each reader of the persistent AVL tree also takes a page of words, and how big the page is.
+const unsigned long long PERSISTENT_PAGE_INTERVAL = 256;
+const size_t PERSISTENT_PAGE_SIZE = 64;
+
+// What one reader thread counts while it queries a tree that is being written to. Every reader's
+// counters get a cache line to themselves, so that readers counting on different threads don't
+// keep taking the line away from each other. Each reader also times itself, from its first query
+// to its last, since the readers are already running before the writer starts its clock.
+struct alignas(64) readerResults
+{
+	unsigned long long lookups = 0;		// The number of lookups the reader made
+	unsigned long long pages = 0;		// The number of pages it took
+	unsigned long long retries = 0;		// The number of reads it had to start over because the writer got in the way
+	unsigned long long anomalies = 0;	// The number of wrong counts or out of order pages it saw
+	double seconds = 0;					// How long it spent querying, by its own clock
+};
+
+void runPersistentTest(options& opts)
+{
+	// This method builds a persistent AVL tree from the words of our input on this thread,
+	// publishing a new version every publishBatch inserts, while the reader threads query it
+	// the whole time. Each reader looks up words from the start of the input over and over,
+	// and every so often takes a page of words with a cursor. We check what the readers see
+	// as they go: nothing is ever removed, so a word's count can never go down from one
+	// lookup to the next, and every page has to be in order. Once the writer is done, the
+	// last version has to hold every word we inserted.
+	//
+	char word[50];
+	PersistentAVL tree(opts.persistentReaders + 1); // One more slot, for the check at the end
+	vector<string> queries;
+
+	WordSource* source = openWordSource(opts);
+
+	while (queries.size() < PERSISTENT_QUERY_WORDS && source->nextWord(word)) // The queries are the first words of the input.
+	{
+		queries.push_back(word);
+	}
+
+	delete source;
+
+	if (queries.empty())
+	{
+		cout << "There are no words to build the persistent AVL tree from\n";
+
+		return;
+	}
+
+	atomic<bool> writerDone(false);
+	vector<readerResults> results(opts.persistentReaders);
+	vector<thread> readerThreads;
+
+	for (int r = 0; r < opts.persistentReaders; r++)
+	{
+		readerThreads.push_back(thread([&, r]
+		{
+			int slot = tree.registerReader();
+			readerResults mine;							// We count on our own stack, and copy the counts out at the end.
+			vector<unsigned int> seen(queries.size());	// The last count we saw for each query word
+			WordCursor cursor;
+			WordEntry page[PERSISTENT_PAGE_SIZE];
+			size_t i = (size_t)r % queries.size();		// Each reader starts at a different word.
+			chrono::steady_clock::time_point readerStartTime = chrono::steady_clock::now();
+
+			while (!writerDone.load(memory_order_relaxed))
+			{
+				unsigned int count = tree.find(slot, queries[i].c_str());
+
+				if (count < seen[i])
+				{
+					mine.anomalies++;
+				}
+
+				seen[i] = count;
+				mine.lookups++;
+				i = (i + 1) % queries.size();
+
+				if (mine.lookups % PERSISTENT_PAGE_INTERVAL == 0) // Every so often, we take the next page of words as well.
+				{
+					size_t filled = tree.nextPage(slot, cursor, page, PERSISTENT_PAGE_SIZE);
+
+					for (size_t j = 1; j < filled; j++)
+					{
+						if (strcmp(page[j - 1].word, page[j].word) >= 0)
+						{
+							mine.anomalies++;
+						}
+					}
+
+					mine.pages++;
+
+					if (cursor.finished) // Once we reach the end, we start over from the first word.
+					{
+						cursor = WordCursor();
+					}
+				}
+			}
+
+			mine.seconds = chrono::duration<double>(chrono::steady_clock::now() - readerStartTime).count();
+			results[r] = mine;
+		}));
+	}
+
+	unsigned long long inserted = 0;
+	unsigned long long sinceLastPublish = 0;
+
+	source = openWordSource(opts);
+
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+	while (source->nextWord(word)) // The writer inserts every word,
+	{
+		tree.insert(word);
+		inserted++;
+
+		if (++sinceLastPublish >= opts.publishBatch) // publishing each batch as it finishes.
+		{
+			tree.publish();
+			sinceLastPublish = 0;
+		}
+	}
+
+	tree.publish(); // The last batch is published too, even if it isn't full.
+
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+
+	writerDone.store(true);
+
+	for (thread& reader : readerThreads)
+	{
+		reader.join();
+	}
+
+	delete source;
+
+	double lookupsPerSecond = 0;
+	unsigned long long totalPages = 0;
+	unsigned long long totalAnomalies = 0;
+
+	for (readerResults& reader : results) // Every reader's throughput is by its own clock, and together they add up.
+	{
+		if (reader.seconds > 0)
+		{
+			lookupsPerSecond += reader.lookups / reader.seconds;
+		}
+
+		totalPages += reader.pages;
+		totalAnomalies += reader.anomalies;
+	}
+
+	// We page through the last version to make sure every word we inserted made it in.
+	int slot = tree.registerReader();
+	WordCursor cursor;
+	WordEntry page[PERSISTENT_PAGE_SIZE];
+	size_t filled;
+	unsigned long long words = 0;
+	unsigned long long distinctWords = 0;
+
+	while ((filled = tree.nextPage(slot, cursor, page, PERSISTENT_PAGE_SIZE)) > 0)
+	{
+		for (size_t j = 0; j < filled; j++)
+		{
+			words += page[j].count;
+		}
+
+		distinctWords += filled;
+	}
+
+	cout << "Persistent AVL (" << opts.persistentReaders << " readers, a version every " << opts.publishBatch << " inserts):\n";
+
+	tree.displayStatistics();
+
+	cout << "Distinct Words: " << distinctWords << "\n";
+	cout << "Total Words: " << words << " (" << inserted << " inserted)\n";
+	cout << "Writer Time: " << seconds << " seconds (wall clock)\n";
+
+	if (seconds > 0)
+	{
+		cout << "Writer Throughput: " << inserted / seconds << " words per second\n";
+	}
+
+	cout << "Reader Throughput: " << lookupsPerSecond << " lookups per second (" << totalPages << " pages)\n";
+
+	cout << "Snapshot Anomalies: " << totalAnomalies << "\n";
+	cout << "Invariants: " << (tree.validate() && words == inserted ? "valid" : "INVALID") << "\n\n";
+}
+
+// How long each number of readers is timed for in the concurrent read benchmark, and how many changes
+// the writer makes at a time before it checks whether it is ahead of its write rate.
+const double CONCURRENT_SECONDS = 0.5;
+const unsigned long long CONCURRENT_WRITE_BATCH = 64;
+
+template <class Datatype>
+void runConcurrentTest(const char* name, Datatype* structure, options& opts)
+{
+	// This method fills a balanced tree with the words of our input, then times how many lookups
+	// reader threads can make while this thread keeps changing the tree at a steady rate. The
+	// writer adds a made up word next to one of the real ones and takes it back out, over and
+	// over, so the tree keeps rotating but the real words never change. That means every lookup
+	// a reader makes has to find exactly the count the word had before we started, which we
+	// check, along with the order of the pages of words each reader takes every so often. We
+	// time one reader, then two, four and so on up to concurrentReaders, to see how the reads
+	// scale while the writer is busy.
+	//
+	char word[50];
+	WordSource* source = openWordSource(opts);
+
+	while (source->nextWord(word)) // We fill the tree first, which we don't time.
+	{
+		structure->insert(word);
+	}
+
+	delete source;
+
+	vector<string> queries;			// Every word in the tree,
+	vector<unsigned int> expected;	// and its count, which no reader should ever see change
+
+	for (WordCount w : structure->words())
+	{
+		queries.push_back(w.word);
+		expected.push_back(w.count);
+	}
+
+	if (queries.empty())
+	{
+		delete structure;
+
+		return;
+	}
+
+	cout << "Concurrent Reads (" << name << ", " << queries.size() << " distinct words, ";
+
+	if (opts.writeRate > 0)
+	{
+		cout << opts.writeRate << " changes per second):\n";
+	}
+	else
+	{
+		cout << "as many changes as the writer can make):\n";
+	}
+
+	for (int readers = 1; ; readers = readers * 2 < opts.concurrentReaders ? readers * 2 : opts.concurrentReaders) // The last step is concurrentReaders itself.
+	{
+		atomic<bool> stop(false);
+		vector<readerResults> results(readers);
+		vector<thread> readerThreads;
+
+		for (int r = 0; r < readers; r++)
+		{
+			readerThreads.push_back(thread([&, r]
+			{
+				readerResults mine; // We count on our own stack, and copy the counts out at the end.
+				WordCursor cursor;
+				WordEntry page[PERSISTENT_PAGE_SIZE];
+				size_t i = (size_t)r * 7919 % queries.size(); // Each reader starts at a different word.
+				chrono::steady_clock::time_point readerStartTime = chrono::steady_clock::now();
+
+				while (!stop.load(memory_order_relaxed))
+				{
+					if (structure->concurrentFind(queries[i].c_str(), &mine.retries) != expected[i])
+					{
+						mine.anomalies++;
+					}
+
+					mine.lookups++;
+					i = (i + 1) % queries.size();
+
+					if (mine.lookups % PERSISTENT_PAGE_INTERVAL == 0) // Every so often, we take the next page of words as well.
+					{
+						size_t filled = structure->concurrentNextPage(cursor, page, PERSISTENT_PAGE_SIZE, &mine.retries);
+
+						for (size_t j = 1; j < filled; j++)
+						{
+							if (strcmp(page[j - 1].word, page[j].word) >= 0)
+							{
+								mine.anomalies++;
+							}
+						}
+
+						if (cursor.finished)
+						{
+							cursor = WordCursor();
+						}
+					}
+				}
+
+				mine.seconds = chrono::duration<double>(chrono::steady_clock::now() - readerStartTime).count();
+				results[r] = mine;
+			}));
+		}
+
+		unsigned long long changes = 0;
+		size_t next = 0;
+		chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+		chrono::steady_clock::time_point endTime = startTime + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(CONCURRENT_SECONDS));
+
+		while (chrono::steady_clock::now() < endTime) // The writer changes the tree at a steady rate until the time is up.
+		{
+			for (unsigned long long j = 0; j < CONCURRENT_WRITE_BATCH; j += 2)
+			{
+				strncpy(word, queries[next].c_str(), 48); // The made up word is a real one with an underscore on the end,
+				word[48] = 0;						  // which the tokenizer treats as a delimiter, so no real word has one.
+				strcat(word, "_");
+
+				structure->insert(word);
+				structure->remove(word);
+				changes += 2;
+				next = (next + 1) % queries.size();
+			}
+
+			if (opts.writeRate > 0) // If we are ahead of the write rate, we wait until we aren't.
+			{
+				this_thread::sleep_until(startTime + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>((double)changes / opts.writeRate)));
+			}
+		}
+
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+
+		stop.store(true);
+
+		for (thread& reader : readerThreads)
+		{
+			reader.join();
+		}
+
+		double lookupsPerSecond = 0;
+		unsigned long long totalLookups = 0;
+		unsigned long long totalRetries = 0;
+		unsigned long long totalAnomalies = 0;
+
+		for (readerResults& reader : results) // Every reader's throughput is by its own clock, and together they add up.
+		{
+			if (reader.seconds > 0)
+			{
+				lookupsPerSecond += reader.lookups / reader.seconds;
+			}
+
+			totalLookups += reader.lookups;
+			totalRetries += reader.retries;
+			totalAnomalies += reader.anomalies;
+		}
+
+		cout << readers << (readers == 1 ? " Reader: " : " Readers: ") << lookupsPerSecond << " lookups per second ("
+			<< lookupsPerSecond / readers << " per reader), " << (totalLookups > 0 ? 1000000.0 * totalRetries / totalLookups : 0)
+			<< " retries per million reads, " << changes / seconds << " changes per second, " << totalAnomalies << " anomalies\n";
+
+		if (readers == opts.concurrentReaders)
+		{
+			break;
+		}
+	}
+
+	cout << "Invariants: " << (structure->validate() ? "valid" : "INVALID") << "\n\n";
+
+	delete structure;
+}
+
+void runConcurrentTests(options& opts)
+{
+	// This method runs the concurrent read benchmark on the two trees that support it.
+	//
+	runConcurrentTest("RBT", new RBT(), opts);
+	runConcurrentTest("AVL", new AVL(), opts);
+}
+
+// The fuzz test picks its words from a small random vocabulary, so that the same words are
+// inserted, decremented and removed over and over, and the datatypes keep running into the
+// cases that only come up when a word is already there (or was there a moment ago).
+const int FUZZ_VOCABULARY = 500;
+
+// The datatypes that can list their words in order return them from words(). The splay tree
+// and the treap only give them out by frequency, so we ask for all of them and sort them back
+// into alphabetical order.
+template <class Datatype>
+vector<WordCount> contentsOf(Datatype* structure)
+{
+	vector<WordCount> contents;
+
+	for (WordCount w : structure->words())
+	{
+		contents.push_back(w);
+	}
+
+	return contents;
+}
+
+template <class Datatype>
+vector<WordCount> contentsByFrequency(Datatype* structure)
+{
+	vector<WordCount> contents = structure->topK((size_t)-1);
+
+	sort(contents.begin(), contents.end(), [](const WordCount& a, const WordCount& b) { return strcmp(a.word, b.word) < 0; });
+
+	return contents;
+}
+
+vector<WordCount> contentsOf(SplayTree* structure) { return contentsByFrequency(structure); }
+vector<WordCount> contentsOf(Treap* structure) { return contentsByFrequency(structure); }
+
+template <class Datatype>
+bool matchesReference(const char* name, Datatype* structure, map<string, unsigned int>& reference)
+{
+	// This method returns true if the datatype holds exactly the words and counts of the
+	// reference map, which keeps them in alphabetical order just like we do. Otherwise,
+	// it prints out the first word where they disagree.
+	//
+	map<string, unsigned int>::iterator expected = reference.begin();
+
+	for (WordCount w : contentsOf(structure))
+	{
+		if (expected == reference.end() || expected->first != w.word || expected->second != w.count)
+		{
+			cout << name << " disagrees with the reference at \"" << w.word << "\" (count " << w.count << ")\n";
+
+			return false;
+		}
+
+		++expected;
+	}
+
+	if (expected != reference.end())
+	{
+		cout << name << " is missing \"" << expected->first << "\"\n";
+
+		return false;
+	}
+
+	return true;
+}
+
+template <class Datatype>
+bool matchesRanks(const char* name, Datatype* structure, map<string, unsigned int>& reference)
+{
+	// This method returns true if every word of the reference has the rank of its place in the
+	// reference, and selecting that place gives the word back. Selecting past the last word
+	// has to give nothing.
+	//
+	size_t index = 0;
+
+	for (map<string, unsigned int>::iterator expected = reference.begin(); expected != reference.end(); ++expected, index++)
+	{
+		WordCount w = structure->select(index);
+
+		if (structure->rank(expected->first.c_str()) != index || w.word == nullptr || expected->first != w.word)
+		{
+			cout << name << " has the wrong rank or word at index " << index << " (\"" << expected->first << "\")\n";
+
+			return false;
+		}
+	}
+
+	if (structure->select(index).word != nullptr)
+	{
+		cout << name << " has a word past its last index\n";
+
+		return false;
+	}
+
+	// A page as long as a size_t can count has to run from its first index to the last word,
+	// which is what used to go wrong when the index plus the count wrapped around.
+	size_t first = reference.size() / 2;
+	map<string, unsigned int>::iterator expected = reference.begin();
+
+	advance(expected, first);
+
+	for (WordCount w : structure->page(first, SIZE_MAX))
+	{
+		if (expected == reference.end() || expected->first != w.word)
+		{
+			cout << name << " has the wrong word in a page of SIZE_MAX words from index " << first << "\n";
+
+			return false;
+		}
+
+		++expected;
+	}
+
+	if (expected != reference.end())
+	{
+		cout << name << " stops a page of SIZE_MAX words from index " << first << " before \"" << expected->first << "\"\n";
+
+		return false;
+	}
+
+	return true;
+}
+
+// The number of words per page when the fuzz test pages through a datatype. It's small and odd,
+// so there are lots of pages and the last one is usually only partly full.
+const size_t FUZZ_PAGE_SIZE = 7;
+
+template <class Datatype>
+bool matchesPages(const char* name, Datatype* structure, map<string, unsigned int>& reference)
+{
+	// This method returns true if paging through the datatype with a cursor hands out every word
+	// of the reference, with its count, exactly once and in order.
+	//
+	map<string, unsigned int>::iterator expected = reference.begin();
+	WordCursor cursor;
+	WordEntry page[FUZZ_PAGE_SIZE];
+	size_t filled;
+
+	while ((filled = structure->nextPage(cursor, page, FUZZ_PAGE_SIZE)) > 0)
+	{
+		for (size_t i = 0; i < filled; i++, ++expected)
+		{
+			if (expected == reference.end() || expected->first != page[i].word || expected->second != page[i].count)
+			{
+				cout << name << " pages out \"" << page[i].word << "\" (count " << page[i].count << ") where the reference doesn't\n";
+
+				return false;
+			}
+		}
+	}
+
+	if (expected != reference.end())
+	{
+		cout << name << " never pages out \"" << expected->first << "\"\n";
+
+		return false;
+	}
+
+	return true;
+}
+
+template <class Datatype>
+bool checkFuzzedDatatype(const char* name, Datatype* structure, map<string, unsigned int>& reference)
+{
+	// An ordered datatype that we changed has to pass its own invariants, hold what the reference holds,
+	// agree with it about the place of every word, and hand out the same words a page at a time. The
+	// BST doesn't keep ranks, so its place in the list is only checked by paging through it.
+	//
+	if (!structure->validate() || !matchesReference(name, structure, reference) || !matchesPages(name, structure, reference))
+	{
+		return false;
+	}
+
+	if constexpr (is_same<Datatype, BST>::value)
+	{
+		return true;
+	}
+	else
+	{
+		return matchesRanks(name, structure, reference);
+	}
+}
+
+template <class Datatype>
+bool checkMergedShards(const char* name, vector<Datatype*>& shards, map<string, unsigned int>& reference)
+{
+	// The shards split a stream of words between them, so merging them has to give back the whole stream.
+	Datatype* merged = mergeAll(shards, 2);
+	bool passed = checkFuzzedDatatype(name, merged, reference);
+
+	delete merged;
+
+	return passed;
+}
+
+// The number of shards each mergeable datatype's second random stream is split between. It's odd, so
+// that a round of the merge tree leaves one shard out.
+const int FUZZ_SHARDS = 5;
+
+void runFuzzTest(options& opts)
+{
+	// This method is a stress test for the datatypes. It runs a seeded random workload of
+	// inserts, decrements and removes on the RBT, AVL, BST and skip list, doing the same to
+	// a std::map that we trust, and every so often it checks that each datatype's invariants
+	// still hold and that it holds exactly what the map does. The other datatypes can only
+	// insert, so after that we insert a second random stream into every datatype and compare
+	// all of them against the map. If anything goes wrong, we say so and stop with the seed,
+	// so that the same workload can be run again with -seed.
+	//
+	mt19937_64 generator(opts.seed);
+	vector<string> vocabulary;
+
+	for (int i = 0; i < FUZZ_VOCABULARY; i++) // We make up the vocabulary first. Short words over a few letters
+	{
+		string word(1 + generator() % 8, 'a'); // share a lot of prefixes, which the radix tree cares about.
+
+		for (size_t j = 0; j < word.length(); j++)
+		{
+			word[j] = (char)('a' + generator() % 4);
+		}
+
+		vocabulary.push_back(word);
+	}
+
+	RBT* RBT_T = new RBT();
+	AVL* AVL_T = new AVL();
+	BST* BST_T = new BST();
+	SkipList* SL = new SkipList(opts.seed, opts.promotionProbability, opts.maxLevel);
+	map<string, unsigned int> reference;
+	unsigned long long checkInterval = opts.fuzzOperations / 20 + 1; // We check everything about twenty times along the way.
+	bool passed = true;
+
+	cout << "Fuzz Test (" << opts.fuzzOperations << " operations, seed " << opts.seed << "):\n";
+
+	for (unsigned long long i = 1; i <= opts.fuzzOperations && passed; i++)
+	{
+		const char* word = vocabulary[generator() % FUZZ_VOCABULARY].c_str();
+		unsigned int operation = generator() % 10;
+
+		if (operation < 6) // Six in ten operations are inserts,
+		{
+			RBT_T->insert(word);
+			AVL_T->insert(word);
+			BST_T->insert(word);
+			SL->insert(word);
+			reference[word]++;
+		}
+		else if (operation < 8) // two are decrements,
+		{
+			map<string, unsigned int>::iterator entry = reference.find(word);
+			bool expected = entry != reference.end();
+
+			if (expected && --entry->second == 0)
+			{
+				reference.erase(entry);
+			}
+
+			if (RBT_T->decrement(word) != expected || AVL_T->decrement(word) != expected ||
+				BST_T->decrement(word) != expected || SL->decrement(word) != expected)
+			{
+				cout << "A datatype disagrees about whether \"" << word << "\" could be decremented\n";
+				passed = false;
+			}
+		}
+		else // and two are removes.
+		{
+			bool expected = reference.erase(word) != 0;
+
+			if (RBT_T->remove(word) != expected || AVL_T->remove(word) != expected ||
+				BST_T->remove(word) != expected || SL->remove(word) != expected)
+			{
+				cout << "A datatype disagrees about whether \"" << word << "\" could be removed\n";
+				passed = false;
+			}
+		}
+
+		if (passed && (i % checkInterval == 0 || i == opts.fuzzOperations))
+		{
+			passed = checkFuzzedDatatype("RBT", RBT_T, reference) && checkFuzzedDatatype("AVL", AVL_T, reference) &&
+				checkFuzzedDatatype("BST", BST_T, reference) && checkFuzzedDatatype("Skip List", SL, reference);
+		}
+	}
+
+	delete RBT_T;
+	delete AVL_T;
+	delete BST_T;
+	delete SL;
+
+	if (passed) // The second half inserts into every datatype, including the ones that can't remove anything.
+	{
+		RBT_T = new RBT();
+		AVL_T = new AVL();
+		BST_T = new BST();
+		SL = new SkipList(opts.seed, opts.promotionProbability, opts.maxLevel);
+		SplayTree* ST = new SplayTree();
+		Treap* TR = new Treap(opts.seed);
+		ART* ART_T = new ART();
+		HashTable* HT = new HashTable();
+		vector<RBT*> RBTs;		// The stream is also split between shards of each datatype that
+		vector<AVL*> AVLs;		// can merge, which are merged back together at the end.
+		vector<BST*> BSTs;
+		vector<SkipList*> SLs;
+
+		for (int i = 0; i < FUZZ_SHARDS; i++)
+		{
+			RBTs.push_back(new RBT());
+			AVLs.push_back(new AVL());
+			BSTs.push_back(new BST());
+			SLs.push_back(new SkipList(opts.seed + i, opts.promotionProbability, opts.maxLevel));
+		}
+
+		reference.clear();
+
+		for (unsigned long long i = 0; i < opts.fuzzOperations; i++)
+		{
+			const char* word = vocabulary[generator() % FUZZ_VOCABULARY].c_str();
+
+			RBTs[i % FUZZ_SHARDS]->insert(word);
+			AVLs[i % FUZZ_SHARDS]->insert(word);
+			BSTs[i % FUZZ_SHARDS]->insert(word);
+			SLs[i % FUZZ_SHARDS]->insert(word);
+
+			RBT_T->insert(word);
+			AVL_T->insert(word);
+			BST_T->insert(word);
+			SL->insert(word);
+			ST->insert(word);
+			TR->insert(word);
+			ART_T->insert(word);
+			HT->insert(word);
+			reference[word]++;
+		}
+
+		passed = checkFuzzedDatatype("RBT", RBT_T, reference) && checkFuzzedDatatype("AVL", AVL_T, reference) &&
+			checkFuzzedDatatype("BST", BST_T, reference) && checkFuzzedDatatype("Skip List", SL, reference) &&
+			matchesReference("Splay Tree", ST, reference) && matchesReference("Treap", TR, reference) &&
+			matchesReference("Adaptive Radix Tree", ART_T, reference) && matchesReference("Hash Table", HT, reference);
+
+		bool mergesPassed = checkMergedShards("Merged RBT", RBTs, reference);			// Every set of shards is merged (and
+		mergesPassed = checkMergedShards("Merged AVL", AVLs, reference) && mergesPassed;	// deleted), even after one fails.
+		mergesPassed = checkMergedShards("Merged BST", BSTs, reference) && mergesPassed;
+		mergesPassed = checkMergedShards("Merged Skip List", SLs, reference) && mergesPassed;
+		passed = passed && mergesPassed;
+
+		if (passed) // Merging a datatype with itself has to double every count.
+		{
+			for (map<string, unsigned int>::iterator entry = reference.begin(); entry != reference.end(); ++entry)
+			{
+				entry->second *= 2;
+			}
+
+			RBT_T->merge(*RBT_T);
+			AVL_T->merge(*AVL_T);
+			BST_T->merge(*BST_T);
+			SL->merge(*SL);
+
+			passed = checkFuzzedDatatype("Self-Merged RBT", RBT_T, reference) && checkFuzzedDatatype("Self-Merged AVL", AVL_T, reference) &&
+				checkFuzzedDatatype("Self-Merged BST", BST_T, reference) && checkFuzzedDatatype("Self-Merged Skip List", SL, reference);
+		}
+
+		delete RBT_T;
+		delete AVL_T;
+		delete BST_T;
+		delete SL;
+		delete ST;
+		delete TR;
+		delete ART_T;
+		delete HT;
+	}
+
+	if (passed)
+	{
+		cout << "Every datatype matched the reference\n\n";
+	}
+	else
+	{
+		cout << "Fuzz test failed (rerun with -seed " << opts.seed << ")\n\n";
+	}
+}
+
+void runTests(options& opts)
 {
 	// This method utilizes the file parser code given by Dr. Thomas in listing 2
 	// of the lab PDF. It opens an input file at the given file path and reads
 	// each word and inserts it into newly constructed RBT, AVL, BST, and Skip
-	// list datatypes, than prints out statistics about each datatype.
+	// list datatypes, than prints out statistics about each datatype. After those
+	// come a splay tree and a treap, which move frequent words toward the root,
+	// an adaptive radix tree, which goes down one byte of the word at a time
+	// instead of comparing whole words, and a hash table, which doesn't keep its
+	// words in order, to show what the ordered datatypes pay for their order.
 	//
 	char c;
 	RBT* RBT_T = new RBT();			// instantiate each of the trees
 	AVL* AVL_T = new AVL();			//
 	BST* BST_T = new BST();			//
-	SkipList* SL = new SkipList();	// and the skip list
+	SkipList* SL = new SkipList(opts.seed, opts.promotionProbability, opts.maxLevel); // and the skip list
+	SplayTree* ST = new SplayTree();	// the splay tree,
+	Treap* TR = new Treap(opts.seed);	// the treap,
+	ART* ART_T = new ART();				// the adaptive radix tree,
+	HashTable* HT = new HashTable();	// and the unordered hash table baseline
+
+	RBT_T->setPrefetching(opts.prefetch); // If we were asked to, the trees prefetch as they insert.
+	AVL_T->setPrefetching(opts.prefetch);
+	BST_T->setPrefetching(opts.prefetch);
 
 	char chari[50]; // assumes no word is longer than 49 characters
-	memset(chari, 0, 50); // zero the word buffer
-	int iPtr;
-	ifstream inFile;
 
 	clock_t dryRunElapsedTime;
 
-	cout << "File: " << file_path << "\n";
+	// The hardware counters for the pass we are on, and the ones we saved from the dry run so
+	// that we can subtract them out of the datatype passes, the same way we do with the time.
+	PerfCounters* counters = nullptr;
+	PerfCounters* dryRunCounters = nullptr;
 
-	for (int pass = 0; pass < 6; pass++)
+	if (opts.measureHardware)
 	{
-		// The time at the very beginning of our pass of the file
-		clock_t startTime = clock();
+		counters = new PerfCounters();
+		dryRunCounters = new PerfCounters();
+	}
 
-		bool IsDelimiter = false, WasDelimiter = false;
 
-		inFile.open(file_path, ios::binary);
-		if (inFile.fail())
+	for (int pass = 0; pass < 10; pass++)
+	{
+		// We read the words of the file with the parser from listing 2 of the lab PDF, or generate them.
+		// The source is set up before we start the clock, so that making up a vocabulary isn't timed.
+		WordSource* source = openWordSource(opts);
+
+		if (source->fail())
 		{
 			cout << "Unable to open input file\n\n" << "Program Exiting\n\nPress ENTER to exit\n";
 			cin.get(c);
 			exit(1);
 		}
-		iPtr = 0;
-		inFile.get(c); // priming read
-		while (!inFile.eof())
+
+		if (pass == 0) // Before the first pass, we print out where our words are coming from.
 		{
-			IsDelimiter = (c == ' ' || c == 10 || c == 13 || c == ',' || c == '.' || c == '\'' ||
-				c == ':' || c == ';' || c == '"' || c == '?' || c == '!' || c == '-' ||
-				c == '(' || c == ')' || c == '[' || c == ']' || c == '_' || c == '*' || c == 9);
-			if (IsDelimiter && !WasDelimiter)   // if THIS character IS a delimiter,and the
-												// last one WASNT, its the end of a word
-			{
-				WasDelimiter = true;
-				if (pass == 2) RBT_T->insert(chari);		// insert this word in the RBT
-				else if (pass == 3) AVL_T->insert(chari);	// insert it in the AVL Tree
-				else if (pass == 4) BST_T->insert(chari);	// insert it in the BST
-				else if (pass == 5)    SL->insert(chari);	// insert it in the skip list
+			source->describe();
 
-				memset(chari, 0, 50); // zero the word buffer
-				iPtr = 0;
+			if (!statisticsEnabled()) // If the counters were compiled out, we let the user know why they all read zero.
+			{
+				cout << "Statistics counters are compiled out of this build (COLLECT_STATISTICS=0)\n";
 			}
-			else if (!IsDelimiter)  chari[iPtr++] = c;  // if this isnt a delimiter, keep going
+		}
+
+		// We reset the peak resident set size so that it tells us the most memory this pass used,
+		// and remember how much was in use before the pass so that we know how much it grew by.
+		bool peakWasReset = MemoryUsage::resetPeak();
+		unsigned long long startResidentBytes = MemoryUsage::residentBytes();
+
+		// The time at the very beginning of our pass of the file
+		clock_t startTime = clock();
+
+		if (counters != nullptr) // If we are measuring hardware events, we start counting right after the clock.
+		{
+			(pass == 1 ? dryRunCounters : counters)->start();
+		}
 
-			WasDelimiter = IsDelimiter;   // forthe NEXT iteration
-			inFile.get(c);
+		while (source->nextWord(chari)) // For each word in the file,
+		{
+			if (pass == 2) RBT_T->insert(chari);		// insert this word in the RBT
+			else if (pass == 3) AVL_T->insert(chari);	// insert it in the AVL Tree
+			else if (pass == 4) BST_T->insert(chari);	// insert it in the BST
+			else if (pass == 5)    SL->insert(chari);	// insert it in the skip list
+			else if (pass == 6)    ST->insert(chari);	// insert it in the splay tree
+			else if (pass == 7)    TR->insert(chari);	// insert it in the treap
+			else if (pass == 8) ART_T->insert(chari);	// insert it in the adaptive radix tree
+			else if (pass == 9)    HT->insert(chari);	// insert it in the hash table
 		}
-		inFile.close();
-		// If the file doesn't end with a delimiter, it will leave the last word unprocessed.
-		// Calculate the elapsed time, insert once more, and display the statistics for this structure...
+
+		// Calculate the elapsed time and display the statistics for this structure...
 		//
 		clock_t endTime = clock();
 
-		// We get the current time, subtract the start time from it, and divide by 1000
+		if (counters != nullptr) // We stop counting hardware events at the same point we stop the clock.
+		{
+			(pass == 1 ? dryRunCounters : counters)->stop();
+		}
+
+		unsigned long long peakResidentBytes = MemoryUsage::peakResidentBytes(); // The most memory the process had in use during the pass
+
+		delete source;
+
+		// We get the current time, subtract the start time from it, and divide by CLOCKS_PER_SEC
 		// to get the elapsed time in seconds. We calculate the elapsed time here since
 		// we don't want our printing and calculating of stats to be included in the elapsed
 		// time.
 		clock_t elapsedTime = endTime - startTime;
 
-		if (pass == 2) { if (strlen(chari)) RBT_T->insert(chari); RBT_T->displayStatistics(); } // RBT
-		else if (pass == 3) { if (strlen(chari)) AVL_T->insert(chari);  AVL_T->displayStatistics(); } // AVL
-		else if (pass == 4) { if (strlen(chari)) BST_T->insert(chari);  BST_T->displayStatistics(); } // BST
-		else if (pass == 5) { if (strlen(chari))    SL->insert(chari);     SL->displayStatistics(); } // skip list
+		if (pass == 2) RBT_T->displayStatistics(); // RBT
+		else if (pass == 3) AVL_T->displayStatistics(); // AVL
+		else if (pass == 4) BST_T->displayStatistics(); // BST
+		else if (pass == 5)    SL->displayStatistics(); // skip list
+		else if (pass == 6)    ST->displayStatistics(); // splay tree
+		else if (pass == 7)    TR->displayStatistics(); // treap
+		else if (pass == 8) ART_T->displayStatistics(); // adaptive radix tree
+		else if (pass == 9)    HT->displayStatistics(); // hash table
 
 		if (pass == 1)
 		{
@@ -106,31 +1786,286 @@ void runTests(char* file_path)
 		}
 		else if (pass > 1)
 		{
-			cout << "Elapsed Time: " << (elapsedTime - dryRunElapsedTime) / 1000.0 << " seconds\n"; // Print out the elapsed time we calculated above.
+			cout << "Elapsed Time: " << (elapsedTime - dryRunElapsedTime) / (double)CLOCKS_PER_SEC << " seconds\n"; // Print out the elapsed time we calculated above.
+
+			if (counters != nullptr) // If we are measuring hardware events, we print them out right under the time.
+			{
+				counters->displayStatistics(dryRunCounters);
+			}
+
+			// The datatypes from earlier passes are still around, so the growth is what this pass added.
+			// If we couldn't reset the peak, it is the peak of the whole program so far.
+			cout << "Peak RSS: " << peakResidentBytes << " bytes" << (peakWasReset ? "" : " (whole program)") << "\n";
+
+			if (peakWasReset && peakResidentBytes > startResidentBytes)
+			{
+				cout << "Peak RSS Growth: " << peakResidentBytes - startResidentBytes << " bytes\n";
+			}
+
+			if (pass == 2) runQueries(RBT_T, opts);			// Run any queries we were given on the RBT,
+			else if (pass == 3) runQueries(AVL_T, opts);	// the AVL tree,
+			else if (pass == 4) runQueries(BST_T, opts);	// the BST,
+			else if (pass == 5) runQueries(SL, opts);		// and the skip list. The datatypes after it don't answer queries.
+
+			if (opts.validate && pass <= 5) // If we were asked to, we check the invariants of the ordered datatypes too.
+			{
+				bool valid = pass == 2 ? RBT_T->validate() : pass == 3 ? AVL_T->validate() : pass == 4 ? BST_T->validate() : SL->validate();
+
+				cout << "Invariants: " << (valid ? "valid" : "INVALID") << "\n";
+			}
 		}
 
 	}
 
+	delete counters;
+	delete dryRunCounters;
+
 	delete RBT_T;
 	delete AVL_T;
 	delete BST_T;
 	delete SL;
+	delete ST;
+	delete TR;
+	delete ART_T;
+	delete HT;
 }
 
 int main(int argc, char* argv[])
 {
-	// This is a very simple entrypoint to the program which just
-	// takes the second argument as a file path and calls the
-	// runTests method to start testing the datatypes.
+	// This is a very simple entrypoint to the program which reads
+	// the options, takes the remaining arguments as input files and
+	// calls the runTests method to start testing the datatypes.
 	//
-	if (argc < 2)
+	options opts;
+
+	opts.seed = (unsigned long long)time(NULL); // Unless we are given a seed, we use the current time.
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-perf") == 0) // -perf reads hardware performance counters during each pass
+		{
+			opts.measureHardware = true;
+		}
+		else if (strcmp(argv[i], "-seed") == 0 && i + 1 < argc) // -seed <n> seeds the random number generators
+		{
+			opts.seed = strtoull(argv[++i], nullptr, 10);
+		}
+		else if (strcmp(argv[i], "-promote") == 0 && i + 1 < argc) // -promote <p> sets the skip list's promotion probability
+		{
+			opts.promotionProbability = atof(argv[++i]);
+
+			if (!(opts.promotionProbability > 0.0 && opts.promotionProbability < 1.0)) // (which is false for NaN too)
+			{
+				cout << "Invalid promotion probability " << argv[i] << ", expected a number between 0 and 1\n";
+
+				return 1;
+			}
+		}
+		else if (strcmp(argv[i], "-maxlevel") == 0 && i + 1 < argc) // -maxlevel <n> sets the tallest a skip list tower can be
+		{
+			opts.maxLevel = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-range") == 0 && i + 2 < argc) // -range <lo> <hi> lists the words from lo to hi in each datatype
+		{
+			opts.rangeLow = argv[++i];
+			opts.rangeHigh = argv[++i];
+		}
+		else if (strcmp(argv[i], "-prefix") == 0 && i + 1 < argc) // -prefix <pre> lists the words starting with pre in each datatype
+		{
+			opts.prefix = argv[++i];
+		}
+		else if (strcmp(argv[i], "-rank") == 0 && i + 1 < argc) // -rank <word> finds the place of word in each datatype
+		{
+			opts.rankWord = argv[++i];
+		}
+		else if (strcmp(argv[i], "-page") == 0 && i + 2 < argc) // -page <first> <count> lists count words from the first-th one in each datatype
+		{
+			opts.pageFirst = strtoull(argv[++i], nullptr, 10);
+			opts.pageCount = strtoull(argv[++i], nullptr, 10);
+		}
+		else if (strcmp(argv[i], "-after") == 0 && i + 2 < argc) // -after <word> <count> lists the count words after word in each datatype
+		{
+			opts.cursorWord = argv[++i];
+			opts.cursorCount = strtoull(argv[++i], nullptr, 10);
+		}
+		else if (strcmp(argv[i], "-export") == 0 && i + 1 < argc) // -export <n> times paging through every word, n at a time, in each datatype
+		{
+			opts.exportPageSize = strtoull(argv[++i], nullptr, 10);
+		}
+		else if (strcmp(argv[i], "-topk") == 0) // -topk times queries for the most frequent words in each datatype
+		{
+			opts.benchmarkTopK = true;
+		}
+		else if (strcmp(argv[i], "-mixed") == 0) // -mixed times a workload of inserts, decrements and removes on each datatype
+		{
+			opts.benchmarkMixed = true;
+		}
+		else if (strcmp(argv[i], "-fold") == 0) // -fold lowercases every word, so that "The" and "the" are the same word
+		{
+			opts.foldCase = true;
+		}
+		else if (strcmp(argv[i], "-generate") == 0 && i + 1 < argc) // -generate <n> benchmarks a generated corpus of n words instead of a file
+		{
+			opts.generatedWords = strtoull(argv[++i], nullptr, 10);
+		}
+		else if (strcmp(argv[i], "-vocab") == 0 && i + 1 < argc) // -vocab <n> sets the number of distinct words in the generated corpus
+		{
+			opts.vocabularySize = (unsigned int)strtoul(argv[++i], nullptr, 10);
+		}
+		else if (strcmp(argv[i], "-zipf") == 0 && i + 1 < argc) // -zipf <s> sets how skewed the generated word frequencies are
+		{
+			opts.zipfExponent = atof(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-length") == 0 && i + 2 < argc) // -length <min> <max> sets the lengths of the generated words
+		{
+			opts.minLength = atoi(argv[++i]);
+			opts.maxLength = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-order") == 0 && i + 1 < argc) // -order <name> sets the order of the generated words
+		{
+			if (!CorpusGenerator::parseOrder(argv[++i], opts.wordOrder))
+			{
+				cout << "Unknown order " << argv[i] << ", expected random, sorted, reverse or adversarial\n";
+
+				return 1;
+			}
+		}
+		else if (strcmp(argv[i], "-out") == 0 && i + 1 < argc) // -out <path> writes the generated corpus to a file instead of benchmarking it
+		{
+			opts.outputPath = argv[++i];
+		}
+		else if (strcmp(argv[i], "-scaling") == 0 && i + 1 < argc) // -scaling <n> runs each datatype over generated corpora of up to n words
+		{
+			opts.scalingMaxWords = strtoull(argv[++i], nullptr, 10);
+		}
+		else if (strcmp(argv[i], "-csv") == 0 && i + 1 < argc) // -csv <path> writes the scaling results to a file
+		{
+			opts.csvPath = argv[++i];
+		}
+		else if (strcmp(argv[i], "-lookup") == 0 && i + 1 < argc) // -lookup <n> times n random lookups on each tree, with and without prefetching
+		{
+			opts.lookups = strtoull(argv[++i], nullptr, 10);
+		}
+		else if (strcmp(argv[i], "-prefetch") == 0) // -prefetch makes the trees prefetch both children of each node as they insert
+		{
+			opts.prefetch = true;
+		}
+		else if (strcmp(argv[i], "-validate") == 0) // -validate checks the invariants of each ordered datatype after its insert pass
+		{
+			opts.validate = true;
+		}
+		else if (strcmp(argv[i], "-fuzz") == 0 && i + 1 < argc) // -fuzz <n> compares every datatype against std::map over n random operations
+		{
+			opts.fuzzOperations = strtoull(argv[++i], nullptr, 10);
+		}
+		else if (strcmp(argv[i], "-threads") == 0 && i + 1 < argc) // -threads <n> tokenizes the input files on n threads while each datatype inserts
+		{
+			opts.threads = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-local") == 0) // -local makes each -threads worker count its words in its own datatype, merging them at the end
+		{
+			opts.localTrees = true;
+		}
+		else if (strcmp(argv[i], "-persistent") == 0 && i + 1 < argc) // -persistent <n> builds a persistent AVL tree while n threads query it
+		{
+			opts.persistentReaders = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-batch") == 0 && i + 1 < argc) // -batch <n> publishes a new version of the persistent AVL tree every n inserts
+		{
+			opts.publishBatch = strtoull(argv[++i], nullptr, 10);
+		}
+		else if (strcmp(argv[i], "-concurrent") == 0 && i + 1 < argc) // -concurrent <n> times up to n threads reading the balanced trees while they change
+		{
+			opts.concurrentReaders = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-writes") == 0 && i + 1 < argc) // -writes <n> sets how many changes per second the writer makes during -concurrent
+		{
+			opts.writeRate = strtoull(argv[++i], nullptr, 10);
+		}
+		else if (strcmp(argv[i], "-window") == 0 && i + 1 < argc) // -window <n> counts only the last n words of the file in each datatype
+		{
+			opts.windowSize = strtoull(argv[++i], nullptr, 10);
+		}
+		else if (!opts.inputs.add(argv[i])) // Anything else names input files: a file, a directory, a pattern or an @list.
+		{
+			return 1;
+		}
+	}
+
+	if (opts.fuzzOperations > 0) // The fuzz test makes up its own words, so it doesn't need a file either.
+	{
+		runFuzzTest(opts);
+
+		return 0;
+	}
+
+	if (opts.scalingMaxWords > 0) // The scaling benchmark generates its own words, so it doesn't need a file.
+	{
+		runScalingTests(opts);
+
+		return 0;
+	}
+
+	if (opts.inputs.empty() && opts.generatedWords == 0)
 	{
 		cout << "No file path provided.";
 
 		return 0;
 	}
 
-	runTests(argv[1]);
+	if (opts.outputPath != nullptr && opts.generatedWords > 0) // If we were asked to write out a generated corpus, that's all we do.
+	{
+		writeCorpus(opts);
+
+		return 0;
+	}
+
+	if (opts.persistentReaders >= 0) // With -persistent, we only build the persistent AVL tree under its readers.
+	{
+		runPersistentTest(opts);
+
+		return 0;
+	}
+
+	if (opts.concurrentReaders > 0) // With -concurrent, we only time the readers of the balanced trees.
+	{
+		runConcurrentTests(opts);
+
+		return 0;
+	}
+
+	if (opts.threads > 0) // With tokenizing threads, we only run the parallel ingestion passes.
+	{
+		if (opts.generatedWords > 0)
+		{
+			cout << "-threads tokenizes input files, so it can't be used with -generate\n";
+
+			return 1;
+		}
+
+		runParallelTests(opts);
+
+		return 0;
+	}
+
+	if (opts.windowSize > 0) // In sliding window mode, we only run the sliding window passes.
+	{
+		runWindowTests(opts);
+
+		return 0;
+	}
+
+	runTests(opts);
+
+	if (opts.benchmarkMixed)
+	{
+		runMixedTests(opts);
+	}
+
+	if (opts.lookups > 0)
+	{
+		runLookupTests(opts);
+	}
 
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,142 @@
+//==============================================================================================
+// File: MemoryUsage.cpp - Memory usage helpers implementation
+// c.f.: MemoryUsage.h
+//
+// These helpers tell us how much memory the datatypes really use. Every datatype knows how
+// many nodes it has and how big a node is, but the allocator rounds every block up and keeps
+// its own bookkeeping, so we also ask the allocator how big each block actually is. On top of
+// that, we read the process's resident set size (how much of it is in physical memory) and
+// its peak, which is what a memory budget is really about. Each platform has its own way to
+// do these things: Visual C++ has _msize and GetProcessMemoryInfo, glibc has
+// malloc_usable_size and Linux has /proc/self/status, whose peak we can reset by writing to
+// /proc/self/clear_refs. Anything a platform can't do reads as zero.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "MemoryUsage.h"
+
+#if defined(_WIN32)
+#include <malloc.h>
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#include <sys/resource.h>
+#else
+#include <malloc.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/resource.h>
+#endif
+
+#ifdef __linux__
+// Returns the value (in kilobytes, converted to bytes) of the line of /proc/self/status that
+// starts with the given name, such as "VmRSS:", or zero if we can't find it.
+static unsigned long long readStatusBytes(const char* name)
+{
+	FILE* status = fopen("/proc/self/status", "r");
+
+	if (status == nullptr)
+	{
+		return 0;
+	}
+
+	char line[256];
+	unsigned long long kilobytes = 0;
+	size_t nameLength = strlen(name);
+
+	while (fgets(line, sizeof(line), status) != nullptr) // We look through each line for the one we want.
+	{
+		if (strncmp(line, name, nameLength) == 0)
+		{
+			kilobytes = strtoull(line + nameLength, nullptr, 10);
+			break;
+		}
+	}
+
+	fclose(status);
+
+	return kilobytes * 1024;
+}
+#endif
+
+size_t MemoryUsage::allocatedSize(void* p)
+{
+	if (p == nullptr)
+	{
+		return 0;
+	}
+
+#if defined(_WIN32)
+	return _msize(p);
+#elif defined(__APPLE__)
+	return malloc_size(p);
+#else
+	return malloc_usable_size(p);
+#endif
+}
+
+unsigned long long MemoryUsage::residentBytes()
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters;
+
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		return counters.WorkingSetSize;
+	}
+
+	return 0;
+#elif defined(__linux__)
+	return readStatusBytes("VmRSS:");
+#else
+	return 0;
+#endif
+}
+
+unsigned long long MemoryUsage::peakResidentBytes()
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters;
+
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		return counters.PeakWorkingSetSize;
+	}
+
+	return 0;
+#elif defined(__linux__)
+	return readStatusBytes("VmHWM:"); // The "high water mark" is the peak resident set size.
+#else
+	rusage usage;
+
+	getrusage(RUSAGE_SELF, &usage);
+
+	return (unsigned long long)usage.ru_maxrss; // macOS reports this in bytes.
+#endif
+}
+
+bool MemoryUsage::resetPeak()
+{
+#ifdef __linux__
+	// Writing 5 to clear_refs resets the high water mark to the current resident set size.
+	FILE* clearRefs = fopen("/proc/self/clear_refs", "w");
+
+	if (clearRefs == nullptr)
+	{
+		return false;
+	}
+
+	bool reset = fputs("5", clearRefs) >= 0;
+
+	return fclose(clearRefs) == 0 && reset;
+#else
+	return false;
+#endif
+}
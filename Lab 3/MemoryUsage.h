@@ -0,0 +1,30 @@
+//==============================================================================================
+// File: MemoryUsage.h - Memory usage helpers
+// Header for MemoryUsage.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <cstddef>
+
+class MemoryUsage
+{
+public:
+	// Returns the number of bytes the allocator actually set aside for the given block, which
+	// is at least the size that was asked for. If the platform can't tell us, we return zero.
+	static size_t allocatedSize(void* p);
+
+	static unsigned long long residentBytes(); // Returns the number of bytes of the process that are in memory right now
+	static unsigned long long peakResidentBytes(); // Returns the most bytes the process has had in memory since the peak was last reset
+
+	// Resets the peak so that peakResidentBytes measures from now on. Returns false if the
+	// platform can't do that, in which case the peak is the peak of the whole program.
+	static bool resetPeak();
+};
@@ -0,0 +1,75 @@
+//==============================================================================================
+// File: MergeTree.h - Parallel merging of many datatypes
+//
+// When words are counted in many separate datatypes (one per worker thread, per shard of a
+// corpus or per day), they have to be combined into one at the end. Merging them all into
+// the first one, one after another, would go over the first datatype's words again for every
+// merge, so the last merges would each cost as much as the whole result. Instead, we merge
+// them in rounds, like the levels of a tree: each round merges the datatypes in pairs, which
+// halves how many there are, until only one is left. Every word takes part in O(log k) merges
+// for k datatypes, and the merges of a round don't share anything, so they run at the same
+// time on separate threads.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Merges every datatype in the list into one and returns it, deleting the rest. The merges of
+// each round are spread over at most the given number of threads. Any datatype with a
+// merge(const Datatype&) method works. Returns nullptr if the list is empty.
+template <class Datatype>
+Datatype* mergeAll(vector<Datatype*> structures, int threads)
+{
+	if (threads < 1) // We need at least one thread to do the merging.
+	{
+		threads = 1;
+	}
+
+	while (structures.size() > 1) // Each round halves the number of datatypes left,
+	{
+		size_t pairs = structures.size() / 2;	// by merging the second of each pair into the first.
+		atomic<size_t> nextPair(0);				// The next pair a thread should take
+		vector<thread> workers;
+
+		for (int t = 0; t < threads && (size_t)t < pairs; t++)
+		{
+			workers.push_back(thread([&structures, &nextPair, pairs]
+			{
+				size_t i;
+
+				while ((i = nextPair++) < pairs) // Each pair is merged by exactly one thread.
+				{
+					structures[2 * i]->merge(*structures[2 * i + 1]);
+
+					delete structures[2 * i + 1];
+				}
+			}));
+		}
+
+		for (thread& worker : workers)
+		{
+			worker.join();
+		}
+
+		vector<Datatype*> merged; // The first of each pair is what is left,
+
+		for (size_t i = 0; i < structures.size(); i += 2)
+		{
+			merged.push_back(structures[i]); // along with the odd one out, if there is one.
+		}
+
+		structures = merged;
+	}
+
+	return structures.empty() ? nullptr : structures[0];
+}
@@ -0,0 +1,79 @@
+//==============================================================================================
+// File: MultiFileSource.cpp - The words of many files, one after another implementation
+// c.f.: MultiFileSource.h
+//
+// The benchmark passes read their words from a single WordSource, so when we are given more
+// than one file, this source reads them one after another with a Tokenizer for each, which
+// makes a whole directory look like one long file to every pass. Only one file is open at a
+// time, so a corpus of thousands of files doesn't run us out of file handles.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "MultiFileSource.h"
+
+MultiFileSource::MultiFileSource(const InputFiles& files, bool foldCase) : files(files)
+{
+	// constructor -- we open the first file right away, so that fail can tell the driver
+	// about it before the first pass starts, the same way a single file is checked.
+	//
+	this->foldCase = foldCase;
+
+	if (!files.empty())
+	{
+		open(0);
+	}
+}
+
+MultiFileSource::~MultiFileSource()
+{
+	delete tokenizer; // The tokenizer closes whichever file we were on.
+}
+
+bool MultiFileSource::fail()
+{
+	return tokenizer == nullptr || tokenizer->fail();
+}
+
+void MultiFileSource::describe()
+{
+	files.describe();
+}
+
+bool MultiFileSource::open(size_t index)
+{
+	delete tokenizer;
+
+	current = index;
+	tokenizer = new Tokenizer(files.path(index), foldCase);
+
+	return !tokenizer->fail();
+}
+
+bool MultiFileSource::nextWord(char word[50])
+{
+	// This method reads the next word of the file we are on. When that file runs out, we
+	// open the next one. A later file that can't be opened (because it was deleted after
+	// we started, say) is reported and skipped instead of ending every pass early.
+	//
+	while (true)
+	{
+		if (tokenizer->nextWord(word))
+		{
+			return true;
+		}
+
+		if (current + 1 >= files.size()) // If that was the last file, we are done.
+		{
+			return false;
+		}
+
+		if (!open(current + 1))
+		{
+			cout << "Unable to open input file " << files.path(current) << ", skipping it\n";
+		}
+	}
+}
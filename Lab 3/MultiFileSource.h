@@ -0,0 +1,43 @@
+//==============================================================================================
+// File: MultiFileSource.h - The words of many files, one after another
+// Header for MultiFileSource.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <iostream>
+#include "InputFiles.h"
+#include "Tokenizer.h"
+#include "WordSource.h"
+
+using namespace std;
+
+class MultiFileSource : public WordSource
+{
+public:
+	// Reads the words of every file in the list, in order. The list has to outlive this source.
+	MultiFileSource(const InputFiles& files, bool foldCase = false);
+	~MultiFileSource();
+
+	bool fail(); // Returns true if the first file couldn't be opened
+
+	void describe(); // Prints out how many files there are
+
+	// Reads the next word of the current file into the given buffer, moving on to the next
+	// file when it runs out. Returns false once every file has run out.
+	bool nextWord(char word[50]);
+private:
+	bool open(size_t index); // Opens the file at the given index of the list, returning false if it can't be
+
+	const InputFiles& files;			// The files we read
+	size_t current = 0;					// The index of the file we are reading
+	Tokenizer* tokenizer = nullptr;		// The tokenizer for that file
+	bool foldCase;						// Whether or not we lowercase each word
+};
@@ -0,0 +1,210 @@
+//==============================================================================================
+// File: PerfCounters.cpp - Hardware performance counters implementation
+// c.f.: PerfCounters.h
+//
+// This class reads the CPU's hardware performance counters through the Linux perf_event_open
+// system call so that the driver can report what the machine did during a benchmark pass
+// (cycles, instructions, L1 data cache misses, last level cache misses and branch misses)
+// next to the logical counters that each datatype keeps. Each event is opened on its own,
+// so if the kernel or a virtual machine refuses one of them, the others still work. On
+// platforms without perf_event_open, none of the events are available and nothing is counted.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "PerfCounters.h"
+
+#ifdef __linux__
+#include <cstring>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+PerfCounters::PerfCounters()
+{
+	// constructor -- we try to open a perf_event file descriptor for every event.
+	// Counting is disabled until start is called. Events we can't open keep a
+	// file descriptor of -1 and are skipped everywhere else.
+	//
+	for (int e = 0; e < NUMBER_OF_EVENTS; e++)
+	{
+		fileDescriptors[e] = -1;
+	}
+
+#ifdef __linux__
+	for (int e = 0; e < NUMBER_OF_EVENTS; e++)
+	{
+		perf_event_attr attributes;
+		memset(&attributes, 0, sizeof(attributes));
+
+		attributes.size = sizeof(attributes);
+		attributes.disabled = 1;		// We start disabled and enable the counter in start,
+		attributes.exclude_kernel = 1;	// and we only count user space, which is all that most
+		attributes.exclude_hv = 1;		// perf_event_paranoid settings allow anyway.
+
+		switch (e)
+		{
+		case CYCLES:
+			attributes.type = PERF_TYPE_HARDWARE;
+			attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+			break;
+		case INSTRUCTIONS:
+			attributes.type = PERF_TYPE_HARDWARE;
+			attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+			break;
+		case L1D_MISSES:
+			// Cache events are encoded as cache id | (operation << 8) | (result << 16).
+			attributes.type = PERF_TYPE_HW_CACHE;
+			attributes.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+			break;
+		case LLC_MISSES:
+			attributes.type = PERF_TYPE_HARDWARE;
+			attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+			break;
+		case BRANCH_MISSES:
+			attributes.type = PERF_TYPE_HARDWARE;
+			attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+			break;
+		}
+
+		// We measure this process on any CPU, with no group leader and no flags.
+		fileDescriptors[e] = (int)syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0);
+	}
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+	// On deconstruction, we close every file descriptor that we were able to open.
+	//
+#ifdef __linux__
+	for (int e = 0; e < NUMBER_OF_EVENTS; e++)
+	{
+		if (fileDescriptors[e] != -1)
+		{
+			close(fileDescriptors[e]);
+		}
+	}
+#endif
+}
+
+bool PerfCounters::isAvailable()
+{
+	// We are available if any single event could be opened.
+	//
+	for (int e = 0; e < NUMBER_OF_EVENTS; e++)
+	{
+		if (fileDescriptors[e] != -1)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void PerfCounters::start()
+{
+	// This method zeroes every open counter and enables it. We reset before
+	// we enable so that the reset itself isn't part of what we measure.
+	//
+#ifdef __linux__
+	for (int e = 0; e < NUMBER_OF_EVENTS; e++)
+	{
+		if (fileDescriptors[e] != -1)
+		{
+			ioctl(fileDescriptors[e], PERF_EVENT_IOC_RESET, 0);
+			ioctl(fileDescriptors[e], PERF_EVENT_IOC_ENABLE, 0);
+		}
+	}
+#endif
+}
+
+void PerfCounters::stop()
+{
+	// This method disables every open counter and reads its value into our
+	// values array. If a read fails for some reason, the value is left at zero.
+	//
+	for (int e = 0; e < NUMBER_OF_EVENTS; e++)
+	{
+		values[e] = 0;
+
+#ifdef __linux__
+		if (fileDescriptors[e] != -1)
+		{
+			ioctl(fileDescriptors[e], PERF_EVENT_IOC_DISABLE, 0);
+
+			unsigned long long value;
+
+			if (read(fileDescriptors[e], &value, sizeof(value)) == sizeof(value))
+			{
+				values[e] = value;
+			}
+		}
+#endif
+	}
+}
+
+unsigned long long PerfCounters::getValue(event e)
+{
+	return values[e]; // This is zero for events that aren't available.
+}
+
+void PerfCounters::displayStatistics(PerfCounters* baseline)
+{
+	// This method prints out each event that we were able to count. When we have a
+	// baseline, we print the difference instead, clamping at zero since the counters
+	// are a little noisy and the difference of two small numbers can go negative.
+	//
+	const char* names[NUMBER_OF_EVENTS] = { "Cycles", "Instructions", "L1D Misses", "LLC Misses", "Branch Misses" };
+
+	if (!isAvailable()) // If no event could be opened, we just say so.
+	{
+		cout << "Hardware Counters: unavailable\n";
+
+		return;
+	}
+
+	cout << "Hardware Counters" << (baseline != nullptr ? " (minus dry run)" : "") << ":\n";
+
+	for (int e = 0; e < NUMBER_OF_EVENTS; e++)
+	{
+		cout << "  " << names[e] << ": ";
+
+		if (fileDescriptors[e] == -1) // If this event couldn't be opened,
+		{
+			cout << "unavailable\n"; // we can't print a value for it.
+
+			continue;
+		}
+
+		unsigned long long value = values[e];
+
+		if (baseline != nullptr) // If we have a baseline, we subtract its value.
+		{
+			value = value > baseline->values[e] ? value - baseline->values[e] : 0;
+		}
+
+		cout << value << "\n";
+	}
+
+	// Instructions per cycle tells us whether we were stalled (on memory) or busy (comparing keys).
+	unsigned long long cycles = values[CYCLES];
+	unsigned long long instructions = values[INSTRUCTIONS];
+
+	if (baseline != nullptr)
+	{
+		cycles = cycles > baseline->values[CYCLES] ? cycles - baseline->values[CYCLES] : 0;
+		instructions = instructions > baseline->values[INSTRUCTIONS] ? instructions - baseline->values[INSTRUCTIONS] : 0;
+	}
+
+	if (fileDescriptors[CYCLES] != -1 && fileDescriptors[INSTRUCTIONS] != -1 && cycles != 0)
+	{
+		cout << "  Instructions per Cycle: " << (double)instructions / cycles << "\n";
+	}
+}
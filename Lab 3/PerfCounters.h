@@ -0,0 +1,55 @@
+//==============================================================================================
+// File: PerfCounters.h - Hardware performance counters
+// Header for PerfCounters.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <iostream>
+
+using namespace std;
+
+class PerfCounters
+{
+public:
+	// The hardware events we measure. NUMBER_OF_EVENTS is not an event, it is just
+	// the amount of events above it so that we can size our arrays with it.
+	enum event
+	{
+		CYCLES,
+		INSTRUCTIONS,
+		L1D_MISSES,
+		LLC_MISSES,
+		BRANCH_MISSES,
+		NUMBER_OF_EVENTS
+	};
+
+	PerfCounters();
+	~PerfCounters();
+
+	// The counters own their perf_event_open file descriptors and close them on deconstruction,
+	// so they can't be copied: both copies would close the same descriptors.
+	PerfCounters(const PerfCounters&) = delete;
+	PerfCounters& operator=(const PerfCounters&) = delete;
+
+	bool isAvailable(); // Returns true if at least one of the hardware events could be opened
+	void start(); // Resets the counters to zero and starts counting
+	void stop(); // Stops counting and saves the values of the counters
+
+	// Returns the value an event had when stop was last called, or zero if the event isn't available.
+	unsigned long long getValue(event e);
+
+	// Displays the saved counter values. If a baseline is given, its values are subtracted
+	// from ours first, which is how we take the dry run's file reading costs out of a pass.
+	void displayStatistics(PerfCounters* baseline = nullptr);
+private:
+	int fileDescriptors[NUMBER_OF_EVENTS];				// The perf_event file descriptor of each event, or -1 if it couldn't be opened
+	unsigned long long values[NUMBER_OF_EVENTS] = {};	// The value of each event when stop was last called
+};
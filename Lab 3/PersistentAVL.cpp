@@ -0,0 +1,581 @@
+//==============================================================================================
+// File: PersistentAVL.cpp - Persistent (copy-on-write) AVL tree implementation
+// c.f.: PersistentAVL.h
+//
+// This class is an AVL tree that readers on other threads can query while one writer keeps
+// inserting words, without either side ever taking a lock. The writer never changes a node
+// that a reader could be looking at. Instead, an insert copies every node on its path down
+// from the root (path copying) and changes the copies, so the new version of the tree shares
+// every subtree the insert didn't touch with the old one. A batch of inserts is made visible
+// all at once by publishing its root with a single atomic store, and a reader that loaded the
+// root before that keeps seeing the old version, which is still whole, until its query is done.
+//
+// Copying a node once per version is enough: a node made for the version being built belongs
+// to the writer alone until it is published, so the rest of the batch changes it in place.
+// Rotations only ever move nodes on the insert's path, which are all copies by then.
+//
+// The nodes a version replaced can't be freed as soon as it is published, since readers of the
+// older version might still be on them. We use epochs to find out when they can be: every query
+// records the epoch it started in, and every publish moves the epoch forward. A replaced node
+// is freed once every query still running started after the publish that replaced it, since
+// those queries started from the new root and can't reach it. Freed nodes go on a free list,
+// like the other trees' removed nodes.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "PersistentAVL.h"
+
+PersistentAVL::PersistentAVL(int maxReaders) : readers(maxReaders < 1 ? 1 : maxReaders)
+{
+	// constructor -- the tree starts out empty, with version zero (the empty tree) published
+	// and version one being built. Every reader slot starts out idle.
+	//
+}
+
+PersistentAVL::~PersistentAVL()
+{
+	// On deconstruction, we delete every node of the next version (which includes every node
+	// of the published one that wasn't replaced), every replaced node still waiting for its
+	// readers, and every node on the free list. Each node is in exactly one of those places.
+	//
+	vector<node*> stack;
+
+	if (root != nullptr)
+	{
+		stack.push_back(root);
+	}
+
+	while (!stack.empty())
+	{
+		node* p = stack.back();
+		stack.pop_back();
+
+		if (p->leftChild != nullptr)
+		{
+			stack.push_back(p->leftChild);
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(p->rightChild);
+		}
+
+		delete p;
+	}
+
+	for (node* p : retiring)
+	{
+		delete p;
+	}
+
+	for (retiredNodes& batch : retired)
+	{
+		for (node* p : batch.nodes)
+		{
+			delete p;
+		}
+	}
+
+	while (freeList != nullptr)
+	{
+		node* del = freeList;
+		freeList = freeList->leftChild;
+		delete del;
+	}
+}
+
+PersistentAVL::node* PersistentAVL::allocateNode()
+{
+	// This method hands out a node for the writer to use, taking one off of the free list
+	// and resetting it if we have one, instead of asking the allocator for a new one.
+	//
+	if (freeList == nullptr)
+	{
+		return new node();
+	}
+
+	node* p = freeList;
+	freeList = freeList->leftChild;
+
+	*p = node();
+
+	return p;
+}
+
+void PersistentAVL::releaseNode(node* p)
+{
+	// This method puts a node that no reader can reach at the front of the free list.
+	p->leftChild = freeList;
+	freeList = p;
+}
+
+PersistentAVL::node* PersistentAVL::makeWritable(node* p)
+{
+	// This method returns a node of the next version that the writer can change in p's place.
+	// If p was made for the next version, nobody else can see it, so it is its own answer.
+	// Otherwise, p is part of a published version, so we copy it and retire p, which the next
+	// version won't point to anymore once the caller links the copy in where p was.
+	//
+	if (p->version == version)
+	{
+		return p;
+	}
+
+	node* copy = allocateNode();
+
+	*copy = *p;
+	copy->version = version;
+
+	retiring.push_back(p);
+	numberOfNodesCopied++;
+	changed = true;
+
+	return copy;
+}
+
+int PersistentAVL::heightOf(node* p)
+{
+	return p == nullptr ? 0 : p->height;
+}
+
+void PersistentAVL::updateHeight(node* p)
+{
+	int leftHeight = heightOf(p->leftChild);
+	int rightHeight = heightOf(p->rightChild);
+
+	p->height = 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+}
+
+PersistentAVL::node* PersistentAVL::rotateLeft(node* a)
+{
+	// a's right child b takes a's place, a becomes b's left child, and b's old left subtree
+	// moves over to be a's right subtree. Both a and b are on the insert's path, so they
+	// are both writable already.
+	//
+	node* b = a->rightChild;
+
+	a->rightChild = b->leftChild;
+	b->leftChild = a;
+
+	updateHeight(a); // a is below b now, so its height has to be worked out first.
+	updateHeight(b);
+	numberOfRotations++;
+
+	return b;
+}
+
+PersistentAVL::node* PersistentAVL::rotateRight(node* a)
+{
+	// This is the mirror image of rotateLeft.
+	//
+	node* b = a->leftChild;
+
+	a->leftChild = b->rightChild;
+	b->rightChild = a;
+
+	updateHeight(a);
+	updateHeight(b);
+	numberOfRotations++;
+
+	return b;
+}
+
+PersistentAVL::node* PersistentAVL::rebalance(node* a)
+{
+	// This method works out a's height again and, if a's subtrees' heights are now two apart,
+	// rotates the taller side up. If the taller child leans the other way, we rotate it first,
+	// which turns the double rotation (LR or RL) into a single one.
+	//
+	updateHeight(a);
+
+	int balance = heightOf(a->leftChild) - heightOf(a->rightChild);
+
+	if (balance > 1) // Too tall on the left,
+	{
+		if (heightOf(a->leftChild->leftChild) < heightOf(a->leftChild->rightChild)) // and the left child leans right (LR).
+		{
+			a->leftChild = rotateLeft(a->leftChild);
+		}
+
+		return rotateRight(a);
+	}
+
+	if (balance < -1) // Too tall on the right,
+	{
+		if (heightOf(a->rightChild->rightChild) < heightOf(a->rightChild->leftChild)) // and the right child leans left (RL).
+		{
+			a->rightChild = rotateRight(a->rightChild);
+		}
+
+		return rotateLeft(a);
+	}
+
+	return a;
+}
+
+void PersistentAVL::insert(const char word[50])
+{
+	// To add a word, we go down the tree like any other insert, except that every node we
+	// go through is swapped for a writable copy first (which is the node itself if this
+	// version already copied it). If the word is there, we count it in its copy. Otherwise
+	// we hang a new node off the bottom of the path and go back up it, fixing heights and
+	// rotating where needed, which is safe since every node on the path is ours to change.
+	//
+	if (root == nullptr) // An empty tree just gets a root.
+	{
+		root = allocateNode();
+		strcpy(root->word, word);
+		root->version = version;
+		changed = true;
+
+		return;
+	}
+
+	root = makeWritable(root);
+	path.clear();
+
+	node* p = root;
+
+	while (true)
+	{
+		path.push_back(p);
+
+		int compareValue = strcmp(word, p->word);
+
+		numberOfKeyComparisonsMade++;
+
+		if (compareValue == 0) // If the word is already here, we just count it.
+		{
+			p->count++;
+			changed = true;
+
+			return;
+		}
+
+		node*& child = compareValue < 0 ? p->leftChild : p->rightChild;
+
+		if (child == nullptr) // If we fell off the bottom, the word goes here.
+		{
+			child = allocateNode();
+			strcpy(child->word, word);
+			child->version = version;
+			changed = true;
+
+			break;
+		}
+
+		child = makeWritable(child); // Otherwise, we go down to a copy of the child that we can change.
+		p = child;
+	}
+
+	// We go back up the path. Once a subtree's height is the same as it was before the insert,
+	// nothing above it can change, so we stop there.
+	for (size_t i = path.size(); i-- > 0; )
+	{
+		node* a = path[i];
+		int oldHeight = a->height;
+		node* subtree = rebalance(a);
+
+		if (i == 0)
+		{
+			root = subtree;
+		}
+		else if (path[i - 1]->leftChild == a)
+		{
+			path[i - 1]->leftChild = subtree;
+		}
+		else
+		{
+			path[i - 1]->rightChild = subtree;
+		}
+
+		if (subtree->height == oldHeight)
+		{
+			break;
+		}
+	}
+}
+
+void PersistentAVL::publish()
+{
+	// This method makes the version we've been building the one readers start from. The root
+	// is stored before the epoch moves on, so a query that starts in the new epoch is sure to
+	// see the new root. A query from the old epoch might be on any node of the old version,
+	// so the nodes this version replaced wait until every query from that epoch is done.
+	//
+	if (!changed) // If nothing changed, there is nothing new to publish.
+	{
+		return;
+	}
+
+	published.store(root);
+	publishedVersion.store(version);
+
+	unsigned long long epoch = globalEpoch.fetch_add(1); // The last epoch whose queries could still be on the old version
+
+	nodesWaiting += retiring.size();
+
+	if (nodesWaiting > mostNodesWaiting)
+	{
+		mostNodesWaiting = nodesWaiting;
+	}
+
+	retired.push_back({ epoch, move(retiring) });
+	retiring.clear();
+
+	version++;
+	changed = false;
+
+	reclaim();
+}
+
+void PersistentAVL::reclaim()
+{
+	// This method finds the epoch of the oldest query still running, and frees every batch of
+	// replaced nodes from a publish before it. The batches are in the order they were retired,
+	// so we can stop at the first one that still has readers.
+	//
+	unsigned long long oldest = globalEpoch.load();
+
+	for (readerSlot& slot : readers)
+	{
+		unsigned long long epoch = slot.epoch.load();
+
+		if (epoch != 0 && epoch < oldest)
+		{
+			oldest = epoch;
+		}
+	}
+
+	while (!retired.empty() && retired.front().epoch < oldest)
+	{
+		for (node* p : retired.front().nodes)
+		{
+			releaseNode(p);
+			numberOfNodesReclaimed++;
+		}
+
+		nodesWaiting -= retired.front().nodes.size();
+		retired.pop_front();
+	}
+}
+
+int PersistentAVL::registerReader()
+{
+	int reader = numberOfReaders++;
+
+	if (reader >= (int)readers.size()) // If every slot is taken, we take this one back and say so.
+	{
+		numberOfReaders--;
+
+		return -1;
+	}
+
+	return reader;
+}
+
+void PersistentAVL::enter(int reader) const
+{
+	// The reader's epoch has to be visible before it loads the root, so that the writer can't
+	// miss it and free a node the reader is about to use. Both are sequentially consistent.
+	readers[reader].epoch.store(globalEpoch.load());
+}
+
+void PersistentAVL::leave(int reader) const
+{
+	readers[reader].epoch.store(0, memory_order_release);
+}
+
+unsigned int PersistentAVL::find(int reader, const char word[50]) const
+{
+	// This method looks for the word in the latest published version. Published nodes never
+	// change, so this is an ordinary search once we have the root.
+	//
+	enter(reader);
+
+	node* p = published.load();
+	unsigned int count = 0;
+
+	while (p != nullptr)
+	{
+		int compareValue = strcmp(word, p->word);
+
+		if (compareValue == 0)
+		{
+			count = p->count;
+
+			break;
+		}
+
+		p = compareValue < 0 ? p->leftChild : p->rightChild;
+	}
+
+	leave(reader);
+
+	return count;
+}
+
+size_t PersistentAVL::nextPage(int reader, WordCursor& cursor, WordEntry* buffer, size_t capacity) const
+{
+	// This method copies out the words after the cursor's word from the latest published
+	// version. We go down to the first word after it, remembering every node we go left of,
+	// which are the nodes that come after it, and then walk in order from there, the same
+	// way the AVL tree's iterator does.
+	//
+	size_t filled = 0;
+	vector<node*> stack;
+
+	enter(reader);
+
+	for (node* p = published.load(); p != nullptr; )
+	{
+		if (!cursor.started || strcmp(p->word, cursor.last) > 0) // p comes after the cursor's word, so it might be the first,
+		{
+			stack.push_back(p);
+			p = p->leftChild;
+		}
+		else // and otherwise the first word is to its right.
+		{
+			p = p->rightChild;
+		}
+	}
+
+	while (!stack.empty() && filled < capacity)
+	{
+		node* p = stack.back();
+		stack.pop_back();
+
+		strcpy(buffer[filled].word, p->word);
+		buffer[filled].count = p->count;
+		filled++;
+
+		for (node* q = p->rightChild; q != nullptr; q = q->leftChild) // The next word is the smallest one to p's right.
+		{
+			stack.push_back(q);
+		}
+	}
+
+	leave(reader);
+
+	if (filled > 0)
+	{
+		strcpy(cursor.last, buffer[filled - 1].word);
+		cursor.started = true;
+	}
+
+	cursor.finished = stack.empty();
+
+	return filled;
+}
+
+unsigned long long PersistentAVL::getPublishedVersion() const
+{
+	return publishedVersion.load();
+}
+
+bool PersistentAVL::validate() const
+{
+	// Like the AVL tree, we check the order with an in-order walk and the heights bottom up with
+	// our own stacks. Every node of the next version also has to have been made for a version
+	// that isn't newer than it.
+	//
+	vector<node*> stack;
+	const char* previous = nullptr;
+
+	for (node* p = root; p != nullptr || !stack.empty(); )
+	{
+		if (p != nullptr)
+		{
+			stack.push_back(p);
+			p = p->leftChild;
+
+			continue;
+		}
+
+		p = stack.back();
+		stack.pop_back();
+
+		if (previous != nullptr && strcmp(previous, p->word) >= 0)
+		{
+			cout << "Persistent AVL is invalid: \"" << p->word << "\" comes after \"" << previous << "\"\n";
+
+			return false;
+		}
+
+		if (p->count == 0 || p->version > version)
+		{
+			cout << "Persistent AVL is invalid: \"" << p->word << "\" has a count of zero or is from a future version\n";
+
+			return false;
+		}
+
+		previous = p->word;
+		p = p->rightChild;
+	}
+
+	vector<pair<node*, bool>> nodes;	// The nodes to visit, and whether their children are done yet
+	vector<int> heights;				// The heights of the subtrees we have finished, in the order we finished them
+
+	nodes.push_back(make_pair(root, false));
+
+	while (!nodes.empty())
+	{
+		node* p = nodes.back().first;
+		bool childrenDone = nodes.back().second;
+
+		nodes.pop_back();
+
+		if (p == nullptr)
+		{
+			heights.push_back(0);
+
+			continue;
+		}
+
+		if (!childrenDone)
+		{
+			nodes.push_back(make_pair(p, true));
+			nodes.push_back(make_pair(p->rightChild, false));
+			nodes.push_back(make_pair(p->leftChild, false));
+
+			continue;
+		}
+
+		int rightHeight = heights.back();
+		heights.pop_back();
+		int leftHeight = heights.back();
+		heights.pop_back();
+
+		if (p->height != 1 + (leftHeight > rightHeight ? leftHeight : rightHeight) || leftHeight - rightHeight < -1 || leftHeight - rightHeight > 1)
+		{
+			cout << "Persistent AVL is invalid: \"" << p->word << "\" has a height of " << p->height
+				<< " but its subtrees' heights are " << leftHeight << " and " << rightHeight << "\n";
+
+			return false;
+		}
+
+		heights.push_back(p->height);
+	}
+
+	return true;
+}
+
+void PersistentAVL::displayStatistics()
+{
+	// This method displays how many versions were published, how much copying that took,
+	// and how well reclamation kept up with the readers.
+	//
+	cout << "Persistent AVL Stats:\n";
+	cout << "Versions Published: " << publishedVersion.load() << "\n";
+	cout << "Height: " << heightOf(root) << "\n";
+	cout << "Node Size: " << sizeof(node) << " bytes\n";
+	cout << "Key Comparisons: " << numberOfKeyComparisonsMade << "\n";
+	cout << "Rotations: " << numberOfRotations << "\n";
+	cout << "Nodes Copied: " << numberOfNodesCopied << "\n";
+	cout << "Nodes Reclaimed: " << numberOfNodesReclaimed << "\n";
+	cout << "Nodes Waiting for Readers: " << nodesWaiting + retiring.size() << " (at most " << mostNodesWaiting << " at once)\n";
+}
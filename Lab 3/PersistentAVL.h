@@ -0,0 +1,118 @@
+//==============================================================================================
+// File: PersistentAVL.h - Persistent (copy-on-write) AVL tree
+// Header for PersistentAVL.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <iostream>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include "Statistics.h"
+#include "WordQuery.h"
+
+using namespace std;
+
+class PersistentAVL
+{
+public:
+	// Constructs an empty tree that up to maxReaders reader threads can query at the same time.
+	PersistentAVL(int maxReaders = 64);
+	~PersistentAVL(); // Deletes every node. No reader can be in the middle of a query when this is called.
+
+	// The writer's side. Only one thread can call these, but it can call them while readers are querying.
+	void insert(const char word[50]); // adds a word to the next version of the tree
+	void publish(); // makes the next version the one readers see, and reclaims the nodes no reader can reach anymore
+
+	// Returns a reader slot for the calling thread to pass to the queries below, or -1 if every
+	// slot is taken. Each reader thread needs a slot of its own.
+	int registerReader();
+
+	// The readers' side. Each query runs against the latest published version, from start to
+	// finish, no matter how many versions the writer publishes in the meantime.
+	unsigned int find(int reader, const char word[50]) const; // Returns the number of times the word has been inserted, or zero
+
+	// Copies the next page of up to capacity words (and their counts), in alphabetical order, into the
+	// buffer, starting after the cursor's last word, and moves the cursor along. Every word of a page
+	// comes from one version, but the next page can come from a newer one.
+	size_t nextPage(int reader, WordCursor& cursor, WordEntry* buffer, size_t capacity) const;
+
+	unsigned long long getPublishedVersion() const; // Returns the number of versions published so far
+
+	// Checks every invariant of the next version in O(n) time without recursion, printing the first
+	// one that is broken. Returns true if it is valid. Only the writer can call this.
+	bool validate() const;
+
+	void displayStatistics(); // Displays statistics about the versions, copies and reclamation. Only the writer can call this.
+private:
+	struct node
+	{
+		char word[50] = {};				// The word of the node
+		unsigned int count = 1;			// The amount of times the word has been inserted into the tree
+		node* leftChild = nullptr;		// A pointer to the left child of the node
+		node* rightChild = nullptr;		// A pointer to the right child of the node
+		int height = 1;					// The number of nodes on the longest path from this node down to a leaf
+		unsigned long long version = 0;	// The version the node was made for. Only nodes of the unpublished version can be changed.
+	};
+
+	// Every reader's epoch gets a cache line to itself, so that readers entering and leaving
+	// queries don't keep taking the line away from each other.
+	struct alignas(64) readerSlot
+	{
+		atomic<unsigned long long> epoch{ 0 }; // The epoch the reader's query started in, or zero if it isn't in a query
+	};
+
+	// The nodes replaced while building one version, which readers of older versions might still be on.
+	struct retiredNodes
+	{
+		unsigned long long epoch;	// The last epoch whose readers could still see these nodes
+		vector<node*> nodes;
+	};
+
+	node* allocateNode(); // Returns a fresh node, reusing one from the free list if we have one
+	void releaseNode(node* p); // Puts a node that no reader can reach onto the free list
+
+	node* makeWritable(node* p); // Returns p if it belongs to the next version, or otherwise a copy of it that does
+
+	static int heightOf(node* p); // Returns the height of the subtree rooted at p, which is zero for nullptr
+	static void updateHeight(node* p); // Recalculates p's height from its children's
+	node* rotateLeft(node* a); // Rotates a's right child up into its place, returning the new root of the subtree
+	node* rotateRight(node* a); // Rotates a's left child up into its place, returning the new root of the subtree
+	node* rebalance(node* a); // Fixes a's height and balance, returning the root of the subtree that was a's
+
+	void enter(int reader) const; // Marks the reader as being in a query, as of the current epoch
+	void leave(int reader) const; // Marks the reader as being done with its query
+	void reclaim(); // Frees every retired node that was replaced before the oldest query still running started
+
+	atomic<node*> published{ nullptr };				// The root of the latest published version, which readers start from
+	atomic<unsigned long long> publishedVersion{ 0 };	// The number of the latest published version
+	atomic<unsigned long long> globalEpoch{ 1 };		// The current epoch, which goes up by one with every publish
+
+	mutable vector<readerSlot> readers;	// The epoch of every reader that is in a query
+	atomic<int> numberOfReaders{ 0 };	// The number of reader slots handed out so far
+
+	node* root = nullptr;				// The root of the next version, which only the writer sees
+	unsigned long long version = 1;		// The number of the next version
+	bool changed = false;				// Whether or not the next version is any different from the published one
+
+	vector<node*> path;					// The nodes on the way down to the word being inserted, reused by every insert
+	vector<node*> retiring;				// The published nodes that have been replaced in the next version
+	deque<retiredNodes> retired;		// The replaced nodes of published versions, oldest first, waiting for their readers to finish
+	node* freeList = nullptr;			// A list of reclaimed nodes, linked through their left children, that we reuse before allocating new ones
+
+	statistic numberOfKeyComparisonsMade = 0;
+	statistic numberOfNodesCopied = 0;
+	statistic numberOfNodesReclaimed = 0;
+	statistic numberOfRotations = 0;
+
+	unsigned long long nodesWaiting = 0;		// The number of replaced nodes waiting for readers right now
+	unsigned long long mostNodesWaiting = 0;	// The most replaced nodes that were ever waiting for readers at once
+};
@@ -0,0 +1,52 @@
+//==============================================================================================
+// File: Prefetch.h - Software prefetch helpers
+//
+// Walking down a tree is a chain of dependent loads: we can't know which child to load until
+// we have compared against the node we are on, so once a tree is bigger than the cache, every
+// step waits on main memory. A prefetch asks the processor to start loading a cache line that
+// we will need soon without waiting for it, so the load overlaps with the work we are doing now.
+// These wrappers hide the difference between the Visual C++ and GCC/Clang intrinsics.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+// The number of independent lookups a batched lookup interleaves. While one lookup waits on
+// memory, the other seven get to compare, so this should be about the number of cache misses
+// the processor can have in flight at once.
+const size_t PREFETCH_GROUP_SIZE = 8;
+
+// Starts loading the cache line that holds the given address into every level of the cache.
+inline void prefetch(const void* p)
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	_mm_prefetch((const char*)p, _MM_HINT_T0);
+#elif defined(__GNUC__)
+	__builtin_prefetch(p, 0, 3);
+#else
+	(void)p; // Without an intrinsic, prefetching does nothing.
+#endif
+}
+
+// Starts loading every cache line of the given object. Our nodes are bigger than 64 bytes and
+// the allocator only lines them up to 16 bytes, so a node can be split across two cache lines,
+// and we want both: the first has the word and the second has the child pointers.
+template <class T>
+inline void prefetchObject(const T* p)
+{
+	if (p != nullptr)
+	{
+		prefetch(p);
+		prefetch((const char*)p + sizeof(T) - 1);
+	}
+}
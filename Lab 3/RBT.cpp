@@ -28,9 +28,11 @@ RBT::RBT()
 
 	strcpy(nil->word, "");	// We copy an empty string into nil's word just to give it a blank value.
 	nil->color = BLACK;		// We set up nil's color to be black to follow the rules.
+	nil->size = 0;			// nil doesn't count as a node in anybody's subtree.
 	nil->parent = nil->leftChild = nil->rightChild = nil; // Nil's parent and children are all nil.
 
 	root = nil; // Since we have no nodes in the tree yet, our root is also nil.
+	freeList = nil; // The free list is empty too. It ends in nil, so that a reader still on a removed node stops there.
 }
 
 RBT::~RBT()
@@ -45,7 +47,14 @@ RBT::~RBT()
 		traverseDestruct(root);
 	}
 
-	// We also need to delete our special nil node.
+	while (freeList != nil) // We also delete every node waiting on the free list,
+	{
+		node* del = freeList;
+		freeList = freeList->leftChild;
+		delete del;
+	}
+
+	// and our special nil node.
 	delete nil;
 
 	// After the traverseDestruct method and deletion of nil, we will
@@ -120,7 +129,8 @@ void RBT::leftRotate(node* x)
 
 	numberOfReferenceChanges += 2;	// We've changed two references so we increment our counter by two.
 
-	numberOfLeftRotations++;		// We've performed a left rotation so we increment our counter.
+	y->size = x->size;	// y now has every node x had under it,
+	x->size = x->leftChild->size + x->rightChild->size + 1; // and x has lost y and y's right subtree.
 }
 
 void RBT::rightRotate(node* x)
@@ -166,7 +176,45 @@ void RBT::rightRotate(node* x)
 
 	numberOfReferenceChanges += 2;	// We've changed two references so we increment our counter by two.
 
-	numberOfRightRotations++;		// We've performed a right rotation so we increment our counter.
+	y->size = x->size;	// y now has every node x had under it,
+	x->size = x->leftChild->size + x->rightChild->size + 1; // and x has lost y and y's left subtree.
+}
+
+RBT::node* RBT::allocateNode()
+{
+	// This method hands out a node for insert to use. If a node was removed
+	// earlier, we take it off of the free list and reset it instead of asking
+	// the allocator for a new one.
+	//
+	node* p;
+
+	if (freeList == nil)	// If there are no free nodes,
+	{
+		p = new node();		// we have to make a new one.
+	}
+	else
+	{
+		p = freeList;					// Otherwise, we take the first free node,
+		freeList = freeList->leftChild;	// and move the free list along.
+	}
+
+	// Either way, we set the node to its defaults one field at a time, since a reader that was
+	// on a reused node when it was removed might still be. Its links are nil, never nullptr, so
+	// a reader that gets to it always stops there, and its word is left for insert to overwrite.
+	p->count = 1;
+	p->color = RED;
+	p->size = 1;
+	p->parent = p->leftChild = p->rightChild = nil;
+
+	return p;
+}
+
+void RBT::releaseNode(node* p)
+{
+	// This method puts a node that was removed from the tree at the front of the free list.
+	// The free list ends with nil, like every path down the tree does.
+	p->leftChild = freeList;
+	freeList = p;
 }
 
 void RBT::insert(const char word[50])
@@ -180,6 +228,8 @@ void RBT::insert(const char word[50])
 	// we have inserted the node, we have to see if we need to perform a fixup of our
 	// tree and fix it if needs be.
 	//
+	SeqLock::writeSection write(seqLock); // Any readers on other threads have to know that we are changing the tree.
+
 	node* x = root; // x will search for where we are going to insert our node,
 	node* y = nil;	// and y will lag one step behind x.
 
@@ -187,13 +237,22 @@ void RBT::insert(const char word[50])
 	// and x's word so that we can use it twice below to avoid a redundant strcmp call.
 	int compareValue;
 
+	size_t depth = 0; // The number of nodes we have compared our word against
+
 	while (x != nil)	// While x isn't nil,
 	{
 		y = x;			// we set y to x.
 
+		if (prefetching) // If we are prefetching, we start loading both children while we compare against x.
+		{
+			prefetchObject(x->leftChild.load());
+			prefetchObject(x->rightChild.load());
+		}
+
 		compareValue = strcmp(word, x->word); // We compare our word to x's word,
 
 		numberOfKeyComparisonsMade++; // and increment our key comparisons since we just made one.
+		depth++;
 
 		if (compareValue < 0) // If word is less than x's word,
 		{
@@ -206,13 +265,20 @@ void RBT::insert(const char word[50])
 		else
 		{
 			x->count++; // We increment our count by one since we found the node,
+			insertDepths.record(depth);
 
 			return;		// then we are done!
 		}
 	}
 
-	node* z = new node();	// We didn't find the node in the tree, so we make a new node.
-	strcpy(z->word, word);	// We copy the word we are going to insert into z's word array.
+	insertDepths.record(depth); // We didn't find the word, so we record how far down we looked before adding it.
+
+	node* z = allocateNode();	// We didn't find the node in the tree, so we make a new node.
+	storeWord(z->word, word);	// We copy the word we are going to insert into z's word array.
+
+	// z is finished before we link it in, since readers on other threads can get to it as soon as we do.
+	z->leftChild = z->rightChild = nil; // Our new node is at the bottom of the tree, so its children are nil.
+	z->color = RED; // We color this node red for now.
 
 	z->parent = y;				// Z's parent becomes y, as y lagged behind x.
 	numberOfReferenceChanges++; // We just updated z's parent so we increment our reference change counter.
@@ -238,8 +304,10 @@ void RBT::insert(const char word[50])
 		numberOfReferenceChanges++; // We just changed one of y's children, so we increment our reference change counter.
 	}
 
-	z->leftChild = z->rightChild = nil; // Our new node is at the bottom of the tree, so its children are nil.
-	z->color = RED; // We color this node red for now.
+	for (node* p = y; p != nil; p = p->parent) // Every node above z now has one more node in its subtree. The rotations
+	{										   // in insertFixup keep the sizes right from here on.
+		p->size++;
+	}
 
 	insertFixup(z); // We fix anything we broke due to the insert.
 }
@@ -277,6 +345,7 @@ void RBT::insertFixup(node* z)
 					z = z->parent;			// z become z's parent,
 
 					leftRotate(z);			// and we perform a left rotation on z.
+					numberOfLeftRotations++;
 
 					numberOfCase2Fixes++;	// We increment our case 2 counter since we just performed a case 2 fix.
 				}
@@ -287,6 +356,7 @@ void RBT::insertFixup(node* z)
 				numberOfRecolorings += 2; // We increment our recolorings counter by two since we adjusted two node colors.
 
 				rightRotate(z->parent->parent);
+				numberOfRightRotations++;
 
 				numberOfCase3Fixes++; // We increment our case 3 counter since we just performed a case 2 fix.
 			}
@@ -311,6 +381,7 @@ void RBT::insertFixup(node* z)
 					z = z->parent;				// z become z's parent,
 
 					rightRotate(z);				// and we perform a right rotation on z.
+					numberOfRightRotations++;
 
 					numberOfCase2Fixes++;		// We increment our case 2 counter since we just performed a case 2 fix.
 				}
@@ -322,6 +393,7 @@ void RBT::insertFixup(node* z)
 				numberOfRecolorings += 2; // We increment our recolorings counter by two since we adjusted two node colors.
 
 				leftRotate(z->parent->parent);
+				numberOfLeftRotations++;
 
 				numberOfCase3Fixes++; // We increment our case 3 counter since we just performed a case 2 fix.
 			}
@@ -332,154 +404,1188 @@ void RBT::insertFixup(node* z)
 	numberOfRecolorings++; // Since we just recolored our root, we increment the number of recolorings by one.
 }
 
-void RBT::list()
+RBT::node* RBT::search(const char word[50])
 {
-	// This method traverses through the entire tree and prints out the nodes in a nicely formatted list
-	// with indexes and the node's word and count.
+	// This method looks for the node with the given word the same way insert does,
+	// returning nil if the word isn't in the tree.
 	//
-	if (root == nil) // If the root is nullptr, than there is nothing in the tree,
+	node* x = root; // We start at the root.
+
+	while (x != nil) // While x isn't nil,
 	{
-		cout << "Set is empty" << endl; // so we just print out "Set is empty"
+		int compareValue = strcmp(word, x->word); // We compare our word to x's word,
+
+		numberOfKeyComparisonsMade++; // and increment our key comparisons since we just made one.
+
+		if (compareValue == 0) // If they are the same, we found it!
+		{
+			return x;
+		}
+
+		x = compareValue < 0 ? x->leftChild : x->rightChild; // Otherwise, we go down the side the word has to be on.
 	}
-	else // otherwise, we actually have nodes in the tree,
+
+	return nil;
+}
+
+bool RBT::remove(const char word[50])
+{
+	// To remove a word, we find its node and delete it from the tree,
+	// regardless of how many times the word was inserted.
+	//
+	SeqLock::writeSection write(seqLock); // Any readers on other threads have to know that we are changing the tree.
+
+	node* z = search(word);
+
+	if (z == nil) // If the word isn't in the tree,
 	{
-		cout << "Set contains: "; // so we print out "Set contains: " as a prefix,
+		return false; // there is nothing to remove.
+	}
 
-		int index = 0; // We set up a index variable to 0 that is incremented before printing a node
+	removeNode(z);
+
+	return true;
+}
+
+bool RBT::decrement(const char word[50])
+{
+	// To decrement a word, we find its node and lower its count by one. If the
+	// count would reach zero, the word is no longer in the set, so we remove it.
+	//
+	SeqLock::writeSection write(seqLock); // Any readers on other threads have to know that we are changing the tree.
+
+	node* z = search(word);
 
-		list(index, root); // We now start our recursive traversal through the root node with our overloaded list method.
+	if (z == nil) // If the word isn't in the tree,
+	{
+		return false; // there is nothing to decrement.
+	}
 
-		cout << endl; // We finish off the output by printing out a newline, as we never did it inside the above method call.
+	if (z->count > 1)	// If the word was inserted more than once,
+	{
+		z->count--;		// we just lower its count.
 	}
-};
+	else
+	{
+		removeNode(z); // Otherwise, it is going away entirely.
+	}
+
+	return true;
+}
 
-void RBT::list(int& index, node* p)
+void RBT::transplant(node* u, node* v)
 {
-	// This method does a recursive traversal through all of the nodes in the tree
-	// and prints out their word and count with an index parameter. The index
-	// parameter is passed by reference so that no matter which recursive call
-	// of this method we are in, the correct index will always be printed out.
-	// Through talking with Dr. Thomas, I learned that the index variable could
-	// have been a class variable instead. I enjoy this method because it does
-	// not require any cleanup or setup of a class variable.
+	// This method replaces the subtree rooted at u with the subtree rooted at v
+	// by linking v into u's spot under u's parent. v can be nil, in which case
+	// we still set nil's parent, which deleteFixup relies on.
+	//
+	if (u->parent == nil)					// If u was the root,
+	{
+		root = v;							// v is now the root.
+	}
+	else if (u == u->parent->leftChild)		// Otherwise, v goes on whichever side of u's parent u was on.
+	{
+		u->parent->leftChild = v;
+	}
+	else
+	{
+		u->parent->rightChild = v;
+	}
+
+	v->parent = u->parent;			// v's parent is now u's old parent.
+	numberOfReferenceChanges += 2;	// We've changed two references.
+}
+
+void RBT::removeNode(node* z)
+{
+	// This method deletes node z from the tree. If z has at most one child, that
+	// child takes z's place. Otherwise, z's successor y is moved into z's place and
+	// takes z's color, so the node that really leaves its spot is y. If the node that
+	// left its spot was black, every path through that spot lost a black node, so we
+	// call deleteFixup on the node x that moved into the spot to fix that.
 	//
-	if (p->leftChild != nil)   // If the left child of the node is not null,
+	node* y = z;						// The node that leaves its spot in the tree
+	bool yOriginalColor = y->color;		// and its color before anything moves
+	node* x;							// The node that moves into y's old spot
+
+	if (z->leftChild != nil && z->rightChild != nil) // If z has two children, its successor is the node that leaves its spot.
 	{
-		list(index, p->leftChild); // we print out the left child node as well, recursively taking care of its children.
+		y = z->rightChild;				// The successor is the smallest word in z's right subtree.
 
-		// Since we have now printed out the left child node, we need to print
-		// out a comma to separate it from the node we are about to print.
-		//
-		cout << ", ";
+		while (y->leftChild != nil)
+		{
+			y = y->leftChild;
+		}
 	}
 
-	// We now print out the index AFTER incrementing it, as well as the node's
-	// word and count.
-	cout << "(" << ++index << ") " << p->word << " " << p->count;
+	for (node* p = y->parent; p != nil; p = p->parent) // Every node above y's spot loses a node from its subtree. We count
+	{												   // that before anything moves, and the rotations in deleteFixup keep it right.
+		p->size--;
+	}
 
-	if (p->rightChild != nil) // If the right child of the node is not null,
+	if (z->leftChild == nil)			// If z has no left child,
+	{
+		x = z->rightChild;				// its right child takes its place.
+		transplant(z, z->rightChild);
+	}
+	else if (z->rightChild == nil)		// If z has no right child,
+	{
+		x = z->leftChild;				// its left child takes its place.
+		transplant(z, z->leftChild);
+	}
+	else								// Otherwise, z has two children, so its successor y takes its place.
 	{
-		// we print out a comma to separate the node we already printed from
-		// the right child we are about to print.
-		cout << ", ";
+		yOriginalColor = y->color;
+		x = y->rightChild;				// y has no left child, so its right child moves into its spot.
+
+		if (y->parent == z)				// If y is z's right child,
+		{
+			x->parent = y;				// x stays under y (even if x is nil).
+			numberOfReferenceChanges++;
+		}
+		else							// Otherwise, y leaves its spot to x,
+		{
+			transplant(y, y->rightChild);
+			y->rightChild = z->rightChild;	// and picks up z's right subtree.
+			y->rightChild->parent = y;
+			numberOfReferenceChanges += 2;
+		}
+
+		transplant(z, y);				// y goes into z's spot,
+		y->leftChild = z->leftChild;	// picks up z's left subtree,
+		y->leftChild->parent = y;
+		y->size = z->size;				// along with z's subtree size,
+		numberOfReferenceChanges += 2;
+
+		if (y->color != z->color)		// and takes z's color.
+		{
+			y->color = z->color;
+			numberOfDeletionRecolorings++;
+		}
+	}
+
+	releaseNode(z);			// z is out of the tree, so it goes onto the free list.
+	numberOfDeletions++;	// We've deleted a node.
 
-		list(index, p->rightChild); // we now print out the right child node as well, recursively taking care of its children.
+	if (yOriginalColor == BLACK)	// If a black node left its spot,
+	{
+		deleteFixup(x);				// we have to fix the black heights.
+	}
+	else
+	{
+		numberOfNoDeletionFixesNeeded++; // Otherwise, the tree is still a valid red-black tree.
 	}
 }
 
-void RBT::calculateNumWords(unsigned int& numWords, unsigned int& numUniqueWords)
+void RBT::deleteFixup(node* x)
 {
-	// This method calculates the number of words and unique words in the tree.
-	// The method takes two unsigned integer references that it initializes to zero.
-	// It then calls the recursive form of this function on the root node. This will
-	// go through each node in the tree and increment both word counters in each call.
+	// This method fixes the tree after a black node was removed from above x. We think of
+	// x as carrying an "extra black". If x is red, we just make it black. Otherwise, we
+	// move the extra black up the tree, or get rid of it by recoloring and rotating around
+	// x's sibling w. These are the four cases from CLRS.
 	//
-	numWords = 0;
-	numUniqueWords = 0;
+	while (x != root && x->color == BLACK) // While x is a black node other than the root,
+	{
+		if (x == x->parent->leftChild) // check if x is its parent's left child.
+		{
+			node* w = x->parent->rightChild; // w is x's sibling.
+
+			if (w->color == RED) // Case 1: w is red, so we recolor and rotate to get a black sibling.
+			{
+				w->color = BLACK;
+				x->parent->color = RED;
+				numberOfDeletionRecolorings += 2;
+				leftRotate(x->parent);
+				numberOfDeletionLeftRotations++;
+				w = x->parent->rightChild;
+				numberOfDeletionCase1Fixes++;
+			}
+
+			if (w->leftChild->color == BLACK && w->rightChild->color == BLACK) // Case 2: both of w's children are black,
+			{
+				w->color = RED;			// so we take a black off of w and x,
+				numberOfDeletionRecolorings++;
+				x = x->parent;			// and move the extra black up to x's parent.
+				numberOfDeletionCase2Fixes++;
+			}
+			else
+			{
+				if (w->rightChild->color == BLACK) // Case 3: w's right child is black, so we rotate w's red left child up.
+				{
+					w->leftChild->color = BLACK;
+					w->color = RED;
+					numberOfDeletionRecolorings += 2;
+					rightRotate(w);
+					numberOfDeletionRightRotations++;
+					w = x->parent->rightChild;
+					numberOfDeletionCase3Fixes++;
+				}
+
+				// Case 4: w's right child is red, so one more recoloring and rotation gets rid of the extra black.
+				w->color = x->parent->color;
+				x->parent->color = BLACK;
+				w->rightChild->color = BLACK;
+				numberOfDeletionRecolorings += 3;
+				leftRotate(x->parent);
+				numberOfDeletionLeftRotations++;
+				x = root; // We are done, so we set x to the root to stop the loop.
+				numberOfDeletionCase4Fixes++;
+			}
+		}
+		else // This else clause is symmetrical to the if statement above, with "left" and "right" swapped.
+		{
+			node* w = x->parent->leftChild; // w is x's sibling.
+
+			if (w->color == RED) // Case 1
+			{
+				w->color = BLACK;
+				x->parent->color = RED;
+				numberOfDeletionRecolorings += 2;
+				rightRotate(x->parent);
+				numberOfDeletionRightRotations++;
+				w = x->parent->leftChild;
+				numberOfDeletionCase1Fixes++;
+			}
+
+			if (w->rightChild->color == BLACK && w->leftChild->color == BLACK) // Case 2
+			{
+				w->color = RED;
+				numberOfDeletionRecolorings++;
+				x = x->parent;
+				numberOfDeletionCase2Fixes++;
+			}
+			else
+			{
+				if (w->leftChild->color == BLACK) // Case 3
+				{
+					w->rightChild->color = BLACK;
+					w->color = RED;
+					numberOfDeletionRecolorings += 2;
+					leftRotate(w);
+					numberOfDeletionLeftRotations++;
+					w = x->parent->leftChild;
+					numberOfDeletionCase3Fixes++;
+				}
+
+				// Case 4
+				w->color = x->parent->color;
+				x->parent->color = BLACK;
+				w->leftChild->color = BLACK;
+				numberOfDeletionRecolorings += 3;
+				rightRotate(x->parent);
+				numberOfDeletionRightRotations++;
+				x = root;
+				numberOfDeletionCase4Fixes++;
+			}
+		}
+	}
 
-	calculateNumWords(root, numWords, numUniqueWords); // We call the calculation method at the root node so we can count the whole tree.
+	x->color = BLACK; // Whatever x ends up as absorbs the extra black.
+	numberOfDeletionRecolorings++;
 }
 
-void RBT::calculateNumWords(node* p, unsigned int& numWords, unsigned int& numUniqueWords)
+void RBT::list()
 {
-	// This method does a recursive traversal through all of the nodes in the tree
-	// and increments the references to the number of words and unique words through
-	// each call.
+	// This method prints out every word in the tree in a nicely formatted list with indexes and
+	// each node's word and count. We used to do this with a recursive traversal, which goes as
+	// deep as the tree does. Instead, we take the words a page at a time through nextPage, the
+	// same way any other listing would, which needs no recursion and only one page of memory.
 	//
-	if (p->leftChild != nil) // If the left child of the node is not null,
+	if (root == nil) // If the root is nil, than there is nothing in the tree,
 	{
-		calculateNumWords(p->leftChild, numWords, numUniqueWords); // we call the method on the left child of the node.
+		cout << "Set is empty" << endl; // so we just print out "Set is empty"
+	}
+	else // otherwise, we actually have nodes in the tree,
+	{
+		cout << "Set contains: "; // so we print out "Set contains: " as a prefix,
+
+		WordCursor cursor;				// We start at the first word,
+		WordEntry page[LIST_PAGE_SIZE];	// and take a page of words at a time.
+		size_t filled;
+		int index = 0; // We set up a index variable to 0 that is incremented before printing a node
+
+		while ((filled = nextPage(cursor, page, LIST_PAGE_SIZE)) > 0)
+		{
+			for (size_t i = 0; i < filled; i++)
+			{
+				if (index != 0) // Every word after the first is separated from the one before it by a comma.
+				{
+					cout << ", ";
+				}
+
+				cout << "(" << ++index << ") " << page[i].word << " " << page[i].count;
+			}
+		}
+
+		cout << endl; // We finish off the output by printing out a newline.
 	}
+};
 
-	if (p->rightChild != nil) // If the right child of the node is not null,
+void RBT::merge(const RBT& other)
+{
+	// This method adds every word of the other tree to this one, along with its count. Inserting
+	// the other tree's words one at a time would cost O(m log(n + m)) and a trip down the tree
+	// for each of them. Instead, we walk both trees in order at the same time, the way merge
+	// sort merges two sorted lists, and then relink the merged list of nodes into a perfectly
+	// balanced tree, so the whole merge takes O(n + m) time. Our own nodes are reused as they
+	// are (only their links change), so only the words that were just in the other tree are
+	// copied. The other tree isn't changed, unless it is this tree, in which case every count
+	// doubles (both iterators are on the same node every step, so it adds its count to itself).
+	//
+	SeqLock::writeSection write(seqLock); // Any readers on other threads have to know that we are changing the tree.
+
+	vector<node*> merged;	// Every node of the merged tree, in alphabetical order
+	iterator mine = lowerBound(nullptr, WordBound());			// Our next word
+	iterator theirs = other.lowerBound(nullptr, WordBound());	// The other tree's next word
+	iterator end;
+
+	while (mine != end || theirs != end) // Until both trees run out,
 	{
-		calculateNumWords(p->rightChild, numWords, numUniqueWords); // we call the method on the left child of the node.
+		int compareValue; // Less than zero if our word comes first, greater than zero if theirs does
+
+		if (mine == end)
+		{
+			compareValue = 1;
+		}
+		else if (theirs == end)
+		{
+			compareValue = -1;
+		}
+		else
+		{
+			compareValue = strcmp(mine.current->word, theirs.current->word);
+			numberOfKeyComparisonsMade++;
+		}
+
+		if (compareValue <= 0) // If our word comes first (or both trees have it), we keep our node,
+		{
+			node* p = mine.current;
+
+			if (compareValue == 0) // adding the other tree's count to ours if it has the word too.
+			{
+				p->count += theirs.current->count;
+				++theirs;
+			}
+
+			merged.push_back(p);
+			++mine;
+		}
+		else // If their word comes first, it needs a node of its own.
+		{
+			node* p = allocateNode();
+
+			storeWord(p->word, theirs.current->word);
+			p->count = theirs.current->count;
+
+			merged.push_back(p);
+			++theirs;
+		}
 	}
 
-	numWords += p->count;	// We increment the number of words by the node's count,
-	numUniqueWords += 1;	// and the number of unique words by one, as each node represents a unique word.
+	// A perfectly balanced tree of n nodes has its top fullLevels levels completely filled, and
+	// whatever is left over sits on the one level below them.
+	int fullLevels = 0;
+
+	while (((size_t)2 << fullLevels) - 1 <= merged.size())
+	{
+		fullLevels++;
+	}
+
+	root = buildBalanced(merged, 0, merged.size(), nil, 1, fullLevels); // We link the nodes up again, balanced.
+	numberOfReferenceChanges++;
 }
 
-unsigned int RBT::getHeight()
+RBT::node* RBT::buildBalanced(vector<node*>& nodes, size_t first, size_t last, node* parent, int depth, int fullLevels)
 {
-	// This method returns the height of the tree. In this program, the height is NOT
-	// the number of child pointer links required to get from the root to the deepest leaf. Instead,
-	// it is the amount of levels of a tree. For example, a tree with no nodes has a height of zero,
-	// and a tree with only a root node has a height of 1.
+	// This method links nodes[first] to nodes[last - 1], which are in alphabetical order, into
+	// a perfectly balanced subtree under the given parent and returns its root (or nil for an
+	// empty range). The middle node is the root, and the nodes on each side of it make up its
+	// subtrees, so the halves never differ in size by more than one. That fills every level
+	// but the last, so coloring the nodes of the full levels black and the leftover nodes on
+	// the last level red gives every path to nil the same number of black nodes, and no red
+	// node can have a red child since all of their children are nil. depth counts the root as 1.
 	//
-	if (root == nil) // If there is no root,
+	if (first == last) // An empty range is an empty subtree.
 	{
-		return 0; // we have no nodes in the tree, so the height is 0.
+		return nil;
 	}
 
-	unsigned int height = 0; // We start at a height of zero, as a root node with no children has a height of 0.
+	size_t middle = first + (last - first) / 2;
+	node* p = nodes[middle];
 
-	// We call our calculate height method on the root node, which will recursively go through
-	// each node in the tree, and properly update our height variable with the height of the entire tree.
-	calculateHeight(root, height, height);
+	p->parent = parent;
+	p->color = depth <= fullLevels ? BLACK : RED;
+	p->leftChild = buildBalanced(nodes, first, middle, p, depth + 1, fullLevels);
+	p->rightChild = buildBalanced(nodes, middle + 1, last, p, depth + 1, fullLevels);
+	p->size = (unsigned int)(last - first);
+	numberOfReferenceChanges += 3;
 
-	return height;
+	return p;
 }
 
-void RBT::calculateHeight(node* p, unsigned int& height, unsigned int traversalHeight)
+RBT::iterator RBT::lowerBound(const char* lo, const WordBound& bound) const
 {
-	// This method does a recursive traversal of the given node and gets called on every node
-	// underneath it. As it traverses through each node, the traversal height gets incremented
-	// by one, and the height gets changed to the traversal height if the traversal height is greater
-	// than it.
+	// This method finds the first word in the tree that isn't less than lo by walking
+	// down the tree and remembering the last node we went left of, since that is the
+	// smallest word we've seen that is big enough. Queries don't count toward our
+	// insert statistics.
 	//
-	if (p->leftChild != nil) // If p has a left child,
-	{
-		// we recursively call calculateHeight on it, incrementing the traversal height by one since we have gone down a level of the tree.
-		calculateHeight(p->leftChild, height, traversalHeight + 1);
-	}
+	iterator it;		// The iterator we are building,
+	it.nil = nil;		// which needs to know our nil node,
+	it.bound = bound;	// and stops at the given bound.
 
-	if (p->rightChild != nil) // If p has a right child,
+	node* p = root; // We start our search at the root.
+
+	while (p != nil) // While we haven't fallen off the bottom of the tree,
 	{
-		// we recursively call calculateHeight on it, incrementing the traversal height by one since we have gone down a level of the tree.
-		calculateHeight(p->rightChild, height, traversalHeight + 1);
+		if (lo == nullptr || strcmp(p->word, lo) >= 0) // if p's word isn't less than lo, p might be our answer,
+		{
+			it.current = p;		// so we remember it,
+			p = p->leftChild;	// and look for a smaller answer to its left.
+		}
+		else					// Otherwise, p's word is too small,
+		{
+			p = p->rightChild;	// so the answer has to be to its right.
+		}
 	}
 
-	if (height < traversalHeight)	// If the height is less than the traversal height,
+	if (it.current != nullptr && !bound.admits(it.current->word)) // If the first word is already past the bound,
 	{
-		height = traversalHeight;	// than we set the height to the traversal height, as we now have a new height of the tree.
+		it.current = nullptr; // our iterator starts at the end.
 	}
+
+	return it;
 }
 
-void RBT::displayStatistics()
+WordRange<RBT::iterator> RBT::words() const
 {
-	// This method displays statistics related to the number of words in the tree and
-	// insertion statistics as nodes are inserted into the RBT tree.
+	// Every word in the tree is the range starting at the smallest word with no bound.
+	return WordRange<iterator>(lowerBound(nullptr, WordBound()), iterator());
+}
+
+WordRange<RBT::iterator> RBT::rangeQuery(const char* lo, const char* hi) const
+{
+	// A range query starts at the first word not less than lo and stops after hi.
+	return WordRange<iterator>(lowerBound(lo, WordBound(WordBound::UPPER_BOUND, hi)), iterator());
+}
+
+WordRange<RBT::iterator> RBT::prefixQuery(const char* prefix) const
+{
+	// Every word that starts with the prefix is at least as big as the prefix itself,
+	// so we start there and stop at the first word that doesn't start with it.
+	return WordRange<iterator>(lowerBound(prefix, WordBound(WordBound::PREFIX, prefix)), iterator());
+}
+
+vector<WordCount> RBT::topK(size_t k) const
+{
+	// We find the top k words with a single pass over every word in the tree.
+	return selectTopK(words(), k);
+}
+
+size_t RBT::nextPage(WordCursor& cursor, WordEntry* buffer, size_t capacity) const
+{
+	// The page starts at the first word that isn't less than the cursor's last word, which we
+	// find the same way a range query does, and fillPage skips that word if it is still here.
+	return fillPage(lowerBound(cursor.started ? cursor.last : nullptr, WordBound()), iterator(), cursor, buffer, capacity);
+}
+
+unsigned int RBT::concurrentFind(const char word[50], unsigned long long* retries) const
+{
+	// This method searches for the word without a lock, checking with the sequence lock
+	// afterwards that the writer didn't change anything while we were looking. If it did, the
+	// count we found might be from a node that was moving (or was being reused for another
+	// word), so we look again.
 	//
-	unsigned int numWords, numUniqueWords; // Declare variables for the total number of words and unique words in the tree
+	while (true)
+	{
+		unsigned long long sequence = seqLock.beginRead();
+		node* p = root;
+		unsigned int count = 0;
+		int steps = 0; // The number of nodes we have gone through, in case the writer sent us around in circles
 
-	// Call the calculateNumWords, passing in our word counts by reference so that they are set to the proper values
-	calculateNumWords(numWords, numUniqueWords);
+		while (p != nil && steps++ < OPTIMISTIC_STEP_LIMIT)
+		{
+			int compareValue = compareWord(word, p->word);
+
+			if (compareValue == 0)
+			{
+				count = p->count;
+
+				break;
+			}
+
+			p = compareValue < 0 ? p->leftChild : p->rightChild;
+		}
+
+		if (seqLock.endRead(sequence)) // If nothing changed while we looked, what we found is right.
+		{
+			return count;
+		}
+
+		if (retries != nullptr)
+		{
+			(*retries)++;
+		}
+	}
+}
+
+size_t RBT::concurrentNextPage(WordCursor& cursor, WordEntry* buffer, size_t capacity, unsigned long long* retries) const
+{
+	// This method copies out a page the same way the iterators walk the tree, remembering the
+	// nodes we go left of on a stack, but without a lock. The cursor is only moved along once
+	// the sequence lock says the whole page was copied while nothing changed. Otherwise the
+	// page might be missing words or have some twice, so we copy it again.
+	//
+	vector<node*> stack;
+
+	while (true)
+	{
+		unsigned long long sequence = seqLock.beginRead();
+		size_t filled = 0;
+		int steps = 0; // The number of nodes we have gone through on one trip down the tree
+
+		stack.clear();
+
+		for (node* p = root; p != nil && steps++ < OPTIMISTIC_STEP_LIMIT; ) // We go down to the first word after the cursor's word,
+		{
+			if (!cursor.started || compareWord(cursor.last, p->word) < 0)
+			{
+				stack.push_back(p);
+				p = p->leftChild;
+			}
+			else
+			{
+				p = p->rightChild;
+			}
+		}
+
+		while (!stack.empty() && filled < capacity) // and copy words out in order from there.
+		{
+			node* p = stack.back();
+			stack.pop_back();
+
+			loadWord(buffer[filled].word, p->word);
+			buffer[filled].count = p->count;
+			filled++;
+
+			steps = 0;
+
+			for (node* q = p->rightChild; q != nil && steps++ < OPTIMISTIC_STEP_LIMIT; q = q->leftChild)
+			{
+				stack.push_back(q);
+			}
+		}
+
+		if (seqLock.endRead(sequence)) // If nothing changed while we copied, the page is good.
+		{
+			if (filled > 0)
+			{
+				strcpy(cursor.last, buffer[filled - 1].word);
+				cursor.started = true;
+			}
+
+			cursor.finished = stack.empty();
+
+			return filled;
+		}
+
+		if (retries != nullptr)
+		{
+			(*retries)++;
+		}
+	}
+}
+
+size_t RBT::rank(const char word[50]) const
+{
+	// This method counts the words before the given word on a single trip down the tree.
+	// Whenever we go right of a node, the node and its whole left subtree come before the
+	// word, and the left subtree's size is stored in its root (nil's size is zero, so we
+	// don't have to check for it). Like the other queries, this isn't counted in our statistics.
+	//
+	size_t before = 0;	// The number of words we know come before the given word
+	node* p = root;
+
+	while (p != nil)
+	{
+		int compareValue = strcmp(word, p->word);
+
+		if (compareValue == 0) // If p is the word, its left subtree is all that is left before it.
+		{
+			return before + p->leftChild->size;
+		}
+
+		if (compareValue < 0) // If the word is to the left, p and everything right of it come after it.
+		{
+			p = p->leftChild;
+		}
+		else // Otherwise, p and everything to its left come before the word.
+		{
+			before += p->leftChild->size + 1;
+			p = p->rightChild;
+		}
+	}
+
+	return before;
+}
+
+WordCount RBT::select(size_t index) const
+{
+	// This method finds the word at the given index by comparing the index with the size
+	// of each node's left subtree on the way down: if the index is smaller, the word is to
+	// the left, if it is the same, it is this node, and otherwise it is to the right, where
+	// we look for the index minus the words we skipped over.
+	//
+	node* p = root;
+
+	while (p != nil)
+	{
+		size_t leftSize = p->leftChild->size;
+
+		if (index < leftSize)
+		{
+			p = p->leftChild;
+		}
+		else if (index == leftSize)
+		{
+			return { p->word, p->count };
+		}
+		else
+		{
+			index -= leftSize + 1;
+			p = p->rightChild;
+		}
+	}
+
+	return { nullptr, 0 }; // We fell off the bottom, so the tree doesn't have that many words.
+}
+
+WordRange<RBT::iterator> RBT::page(size_t index, size_t count) const
+{
+	// A page is a range query from the word at its first index to the word at its last one.
+	// If the page starts past the last word (or is empty), it has nothing in it. If it runs
+	// past the last word, it just stops there.
+	//
+	WordCount first = select(index);
+
+	if (first.word == nullptr || count == 0)
+	{
+		return WordRange<iterator>(iterator(), iterator());
+	}
+
+	// The first word is there, so index is less than the number of words, and we can compare
+	// count to the words left from index on without index + count ever overflowing.
+	size_t size = root->size;
+	size_t lastIndex = count > size - index ? size - 1 : index + count - 1;
+	WordCount last = select(lastIndex);
+
+	return WordRange<iterator>(lowerBound(first.word, WordBound(WordBound::UPPER_BOUND, last.word)), iterator());
+}
+
+FrozenTree* RBT::freeze() const
+{
+	// Our in-order traversal hands the words over already sorted, which is all a frozen tree needs.
+	//
+	vector<WordCount> sortedWords;
+
+	for (WordCount w : words())
+	{
+		sortedWords.push_back(w);
+	}
+
+	return new FrozenTree(sortedWords);
+}
+
+WordCount RBT::iterator::operator*() const
+{
+	return { current->word, current->count };
+}
+
+RBT::iterator& RBT::iterator::operator++()
+{
+	// To move on to the next word, we find the current node's successor. If it has a
+	// right subtree, the successor is the smallest word in it. Otherwise, we climb up
+	// until we come up from a left child, and that parent is the successor. If we
+	// climb past the root, there is no successor and we are at the end.
+	//
+	node* p = current;
+
+	if (p->rightChild != nil) // If there is a right subtree,
+	{
+		p = p->rightChild; // we go into it,
+
+		while (p->leftChild != nil)	// and all the way to the left.
+		{
+			p = p->leftChild;
+		}
+	}
+	else
+	{
+		node* q = p->parent; // q lags one step above p as we climb.
+
+		while (q != nil && p == q->rightChild) // While we are coming up from a right child,
+		{
+			p = q;			// we keep climbing.
+			q = q->parent;
+		}
+
+		p = q; // q is now the successor, or nil if there isn't one.
+	}
+
+	current = (p == nil || !bound.admits(p->word)) ? nullptr : p; // We are at the end if there is no successor or it is past the bound.
+
+	return *this;
+}
+
+bool RBT::iterator::operator==(const iterator& other) const
+{
+	return current == other.current;
+}
+
+bool RBT::iterator::operator!=(const iterator& other) const
+{
+	return current != other.current;
+}
+
+void RBT::calculateNumWords(unsigned long long& numWords, unsigned long long& numUniqueWords)
+{
+	// This method calculates the number of words and unique words in the tree.
+	// The method takes two unsigned integer references that it initializes to zero.
+	// It then calls the recursive form of this function on the root node. This will
+	// go through each node in the tree and increment both word counters in each call.
+	//
+	numWords = 0;
+	numUniqueWords = 0;
+
+	if (root != nil) // If the tree isn't empty,
+	{
+		calculateNumWords(root, numWords, numUniqueWords); // we call the calculation method at the root node so we can count the whole tree.
+	}
+}
+
+void RBT::calculateNumWords(node* p, unsigned long long& numWords, unsigned long long& numUniqueWords)
+{
+	// This method does a recursive traversal through all of the nodes in the tree
+	// and increments the references to the number of words and unique words through
+	// each call.
+	//
+	if (p->leftChild != nil) // If the left child of the node is not null,
+	{
+		calculateNumWords(p->leftChild, numWords, numUniqueWords); // we call the method on the left child of the node.
+	}
+
+	if (p->rightChild != nil) // If the right child of the node is not null,
+	{
+		calculateNumWords(p->rightChild, numWords, numUniqueWords); // we call the method on the left child of the node.
+	}
+
+	numWords += p->count;	// We increment the number of words by the node's count,
+	numUniqueWords += 1;	// and the number of unique words by one, as each node represents a unique word.
+}
+
+unsigned int RBT::getHeight()
+{
+	// This method returns the height of the tree. In this program, the height is NOT
+	// the number of child pointer links required to get from the root to the deepest leaf. Instead,
+	// it is the amount of levels of a tree. For example, a tree with no nodes has a height of zero,
+	// and a tree with only a root node has a height of 1.
+	//
+	if (root == nil) // If there is no root,
+	{
+		return 0; // we have no nodes in the tree, so the height is 0.
+	}
+
+	unsigned int height = 0; // We start at a height of zero, as a root node with no children has a height of 0.
+
+	// We call our calculate height method on the root node, which will recursively go through
+	// each node in the tree, and properly update our height variable with the height of the entire tree.
+	calculateHeight(root, height, height);
+
+	return height;
+}
+
+void RBT::calculateHeight(node* p, unsigned int& height, unsigned int traversalHeight)
+{
+	// This method does a recursive traversal of the given node and gets called on every node
+	// underneath it. As it traverses through each node, the traversal height gets incremented
+	// by one, and the height gets changed to the traversal height if the traversal height is greater
+	// than it.
+	//
+	if (p->leftChild != nil) // If p has a left child,
+	{
+		// we recursively call calculateHeight on it, incrementing the traversal height by one since we have gone down a level of the tree.
+		calculateHeight(p->leftChild, height, traversalHeight + 1);
+	}
+
+	if (p->rightChild != nil) // If p has a right child,
+	{
+		// we recursively call calculateHeight on it, incrementing the traversal height by one since we have gone down a level of the tree.
+		calculateHeight(p->rightChild, height, traversalHeight + 1);
+	}
+
+	if (height < traversalHeight)	// If the height is less than the traversal height,
+	{
+		height = traversalHeight;	// than we set the height to the traversal height, as we now have a new height of the tree.
+	}
+}
+
+unsigned int RBT::find(const char word[50])
+{
+	// This method walks down the tree looking for the word, just like insert does, but
+	// it doesn't change anything. Lookups don't count toward our insert statistics.
+	//
+	node* p = root;
+	size_t depth = 0; // The number of nodes we have compared our word against
+
+	while (p != nil) // While there are more nodes to look at,
+	{
+		if (prefetching) // we start loading both children if we are prefetching,
+		{
+			prefetchObject(p->leftChild.load());
+			prefetchObject(p->rightChild.load());
+		}
+
+		int compareValue = strcmp(word, p->word); // compare our word to p's word,
+
+		depth++;
+
+		if (compareValue == 0) // and if they are the same, we found it!
+		{
+			lookupDepths.record(depth);
+
+			return p->count;
+		}
+
+		p = compareValue < 0 ? p->leftChild : p->rightChild; // Otherwise, we go down the side the word has to be on.
+	}
+
+	lookupDepths.record(depth);
+
+	return 0; // We fell off of the tree, so the word isn't in it.
+}
+
+unsigned int RBT::depthOf(const char* word) const
+{
+	// This method walks down the tree like find does, but only keeps track of how deep it is.
+	//
+	node* p = root;
+	unsigned int depth = 1;
+
+	while (p != nil)
+	{
+		int compareValue = strcmp(word, p->word);
+
+		if (compareValue == 0)
+		{
+			return depth;
+		}
+
+		p = compareValue < 0 ? p->leftChild : p->rightChild;
+		depth++;
+	}
+
+	return 0;
+}
+
+void RBT::findBatch(const char* const words[], size_t numberOfWords, unsigned int counts[])
+{
+	// This method looks up a whole array of words. Without prefetching, we just call find on
+	// each one. With prefetching, we look words up PREFETCH_GROUP_SIZE at a time, taking one
+	// step down the tree for each lookup in the group in turn. After each step, we prefetch
+	// the node that lookup will compare against next, and by the time we come back around to
+	// it, the node should be in the cache. This way, the lookups in a group wait on memory
+	// at the same time instead of one after another.
+	//
+	if (!prefetching)
+	{
+		for (size_t i = 0; i < numberOfWords; i++)
+		{
+			counts[i] = find(words[i]);
+		}
+
+		return;
+	}
+
+	for (size_t start = 0; start < numberOfWords; start += PREFETCH_GROUP_SIZE) // For each group of words,
+	{
+		size_t groupSize = numberOfWords - start < PREFETCH_GROUP_SIZE ? numberOfWords - start : PREFETCH_GROUP_SIZE;
+		node* cursors[PREFETCH_GROUP_SIZE];	// The node each lookup in the group is on, or nil once it is done
+		size_t depths[PREFETCH_GROUP_SIZE];	// The number of nodes each lookup in the group has compared against
+		size_t active = 0;					// The number of lookups in the group that aren't done yet
+
+		for (size_t i = 0; i < groupSize; i++) // every lookup starts at the root.
+		{
+			cursors[i] = root;
+			counts[start + i] = 0;
+			depths[i] = 0;
+
+			if (root != nil)
+			{
+				active++;
+			}
+		}
+
+		while (active > 0) // While any lookup in the group isn't done,
+		{
+			for (size_t i = 0; i < groupSize; i++) // we take one step with each lookup.
+			{
+				node* p = cursors[i];
+
+				if (p == nil) // This lookup is already done.
+				{
+					continue;
+				}
+
+				int compareValue = strcmp(words[start + i], p->word);
+
+				depths[i]++;
+
+				if (compareValue == 0) // If we found the word, we have its count and this lookup is done.
+				{
+					counts[start + i] = p->count;
+					p = nil;
+				}
+				else
+				{
+					p = compareValue < 0 ? p->leftChild : p->rightChild;
+				}
+
+				if (p == nil)
+				{
+					lookupDepths.record(depths[i]);
+					active--;
+				}
+				else
+				{
+					prefetchObject(p); // We start loading the next node now, and come back to it after the rest of the group.
+				}
+
+				cursors[i] = p;
+			}
+		}
+	}
+}
+
+void RBT::setPrefetching(bool enabled)
+{
+	prefetching = enabled;
+}
+
+const DepthHistogram& RBT::getLookupDepths() const
+{
+	return lookupDepths;
+}
+
+bool RBT::validate() const
+{
+	// Besides the order, a red-black tree has to follow the color rules: the root and nil are
+	// black, a red node's children are both black, and every path from a node down to nil goes
+	// through the same number of black nodes (its black height). Every child also has to point
+	// back at its parent. We work the black heights out bottom up with our own stacks, the same
+	// way the AVL tree works out its heights: by the time we check a node, the black heights of
+	// its left and right subtrees are the top two entries of blackHeights.
+	//
+	const char* previous = nullptr; // The word before the one we are on, in alphabetical order
+
+	for (WordCount w : words()) // An in-order walk has to see the words in strictly increasing order,
+	{
+		if (previous != nullptr && strcmp(previous, w.word) >= 0)
+		{
+			cout << "RBT is invalid: \"" << w.word << "\" comes after \"" << previous << "\"\n";
+
+			return false;
+		}
+
+		if (w.count == 0) // and every word in the tree has to have been inserted at least once.
+		{
+			cout << "RBT is invalid: \"" << w.word << "\" has a count of zero\n";
+
+			return false;
+		}
+
+		previous = w.word;
+	}
+
+	if (nil->color != BLACK || nil->size != 0)
+	{
+		cout << "RBT is invalid: nil is red or has a size\n";
+
+		return false;
+	}
+
+	if (root != nil && (root->color != BLACK || root->parent != nil))
+	{
+		cout << "RBT is invalid: the root \"" << root->word << "\" is red or has a parent\n";
+
+		return false;
+	}
+
+	vector<pair<node*, bool>> stack;	// The nodes to visit, and whether their children are done yet
+	vector<int> blackHeights;			// The black heights of the subtrees we have finished, in the order we finished them
+
+	stack.push_back(make_pair(root, false));
+
+	while (!stack.empty())
+	{
+		node* p = stack.back().first;
+		bool childrenDone = stack.back().second;
+
+		stack.pop_back();
+
+		if (p == nil) // nil is black, so the path down to it has one black node.
+		{
+			blackHeights.push_back(1);
+
+			continue;
+		}
+
+		if (!childrenDone) // The first time we see a node, we come back to it after its children.
+		{
+			stack.push_back(make_pair(p, true));
+			stack.push_back(make_pair(p->rightChild, false));
+			stack.push_back(make_pair(p->leftChild, false));
+
+			continue;
+		}
+
+		int rightBlackHeight = blackHeights.back();
+		blackHeights.pop_back();
+		int leftBlackHeight = blackHeights.back();
+		blackHeights.pop_back();
+
+		if (leftBlackHeight != rightBlackHeight)
+		{
+			cout << "RBT is invalid: \"" << p->word << "\" has black heights of " << leftBlackHeight
+				<< " on its left and " << rightBlackHeight << " on its right\n";
+
+			return false;
+		}
+
+		if (p->size != 1 + p->leftChild->size + p->rightChild->size) // Each subtree size has to add up as well.
+		{
+			cout << "RBT is invalid: \"" << p->word << "\" has a subtree size of " << p->size << " but "
+				<< p->leftChild->size << " nodes on its left and " << p->rightChild->size << " on its right\n";
+
+			return false;
+		}
+
+		if (p->color == RED && (p->leftChild->color == RED || p->rightChild->color == RED))
+		{
+			cout << "RBT is invalid: \"" << p->word << "\" is red and has a red child\n";
+
+			return false;
+		}
+
+		if ((p->leftChild != nil && p->leftChild->parent != p) || (p->rightChild != nil && p->rightChild->parent != p))
+		{
+			cout << "RBT is invalid: a child of \"" << p->word << "\" doesn't point back at it\n";
+
+			return false;
+		}
+
+		blackHeights.push_back(leftBlackHeight + (p->color == BLACK ? 1 : 0));
+	}
+
+	return true;
+}
+
+unsigned long long RBT::getKeyComparisons()
+{
+	return numberOfKeyComparisonsMade;
+}
+
+unsigned long long RBT::getReferenceChanges()
+{
+	return numberOfReferenceChanges;
+}
+
+unsigned long long RBT::getMemoryUsage()
+{
+	// This method returns the number of bytes the nodes of the tree take up. Every distinct
+	// word has a node, so this is just the number of nodes times the size of a node.
+	// We also count our nil node, since every tree has one.
+	//
+	unsigned long long numWords, numUniqueWords;
+
+	calculateNumWords(numWords, numUniqueWords);
+
+	return (numUniqueWords + 1) * sizeof(node);
+}
+
+unsigned long long RBT::getAllocatedBytes()
+{
+	// This method adds up how big the allocator says each node's block really is, which
+	// includes whatever the allocator rounded the node's size up by. We visit every node
+	// with our own stack of nodes, the same way the iterators do. Our nil node is counted too.
+	//
+	unsigned long long bytes = MemoryUsage::allocatedSize(nil);
+	vector<node*> stack;
+
+	if (root != nil)
+	{
+		stack.push_back(root);
+	}
+
+	while (!stack.empty()) // While there are still nodes to visit,
+	{
+		node* p = stack.back(); // we take one off of the stack,
+		stack.pop_back();
+
+		bytes += MemoryUsage::allocatedSize(p); // count its block,
+
+		if (p->leftChild != nil) // and push its children to visit later.
+		{
+			stack.push_back(p->leftChild);
+		}
+
+		if (p->rightChild != nil)
+		{
+			stack.push_back(p->rightChild);
+		}
+	}
+
+	return bytes + getFreeListBytes(); // The removed nodes on the free list are still ours too.
+}
+
+unsigned long long RBT::getFreeListBytes()
+{
+	// This method adds up the blocks of the removed nodes waiting on the free list. They
+	// aren't part of the tree anymore, but the allocator hasn't gotten them back either.
+	//
+	unsigned long long bytes = 0;
+
+	for (node* p = freeList; p != nil; p = p->leftChild)
+	{
+		bytes += MemoryUsage::allocatedSize(p);
+	}
+
+	return bytes;
+}
+
+void RBT::displayStatistics()
+{
+	// This method displays statistics related to the number of words in the tree and
+	// insertion statistics as nodes are inserted into the RBT tree.
+	//
+	unsigned long long numWords, numUniqueWords; // Declare variables for the total number of words and unique words in the tree
+
+	// Call the calculateNumWords, passing in our word counts by reference so that they are set to the proper values
+	calculateNumWords(numWords, numUniqueWords);
+
+	unsigned long long liveBytes = getMemoryUsage(); // We also find out how much memory the nodes take up,
+	unsigned long long allocatedBytes = getAllocatedBytes(); // and how much the allocator really set aside for them.
+	unsigned long long freeListBytes = getFreeListBytes(); // Some of that may be removed nodes waiting on the free list.
 
 	cout << "RBT Stats:\n"; // Print out a header specifying that these are RBT stats
 	cout << "Distinct Words: " << numUniqueWords << "\n"; // Print out the total number of unique words
 	cout << "Total Words: " << numWords << "\n"; // Print out the total number of words
 	cout << "Height: " << getHeight() << "\n"; // Print out the height of the tree
+	cout << "Node Size: " << sizeof(node) << " bytes\n"; // Print out how big a single node is
+	cout << "Live Bytes: " << liveBytes << "\n"; // Print out the number of bytes the nodes take up
+	cout << "Allocated Bytes: " << allocatedBytes << "\n"; // Print out the number of bytes the allocator set aside for them
+	cout << "Free List Bytes: " << freeListBytes << "\n"; // Print out how much of that is removed nodes waiting to be reused
+	cout << "Allocator Overhead: " << (allocatedBytes > liveBytes + freeListBytes ? allocatedBytes - liveBytes - freeListBytes : 0) << " bytes\n"; // Print out how much of the rest is rounding
+	cout << "Bytes per Distinct Word: " << (numUniqueWords > 0 ? (double)allocatedBytes / numUniqueWords : 0) << "\n"; // Print out what each distinct word costs
 	cout << "Key Comparisons: " << numberOfKeyComparisonsMade << "\n"; // Print out the number of key comparisons made
 	cout << "Reference Changes: " << numberOfReferenceChanges << "\n"; // Print out the number of reference changes made
 	cout << "Recolorings: " << numberOfRecolorings << "\n"; // Print out the number of recolorings made
@@ -489,4 +1595,17 @@ void RBT::displayStatistics()
 	cout << "Case 2 fix-ups: " << numberOfCase2Fixes << "\n"; // Print out the number of case 2 fixes performed
 	cout << "Case 3 fix-ups: " << numberOfCase3Fixes << "\n"; // Print out the number of case 3 fixes performed
 	cout << "No Fixes Needed: " << numberOfNoFixesNeeded << "\n";  // Print out the total number of insertions without any fixes needed
+	cout << "Deletions: " << numberOfDeletions << "\n"; // Print out the total number of nodes removed
+	cout << "Deletion Recolorings: " << numberOfDeletionRecolorings << "\n"; // Print out the number of recolorings made during deletions
+	cout << "Deletion Left Rotations: " << numberOfDeletionLeftRotations << "\n"; // Print out the number of left rotations made during deletions
+	cout << "Deletion Right Rotations: " << numberOfDeletionRightRotations << "\n"; // Print out the number of right rotations made during deletions
+	cout << "Deletion Case 1 fix-ups: " << numberOfDeletionCase1Fixes << "\n"; // Print out the number of each case of deletion fix performed
+	cout << "Deletion Case 2 fix-ups: " << numberOfDeletionCase2Fixes << "\n";
+	cout << "Deletion Case 3 fix-ups: " << numberOfDeletionCase3Fixes << "\n";
+	cout << "Deletion Case 4 fix-ups: " << numberOfDeletionCase4Fixes << "\n";
+	cout << "No Deletion Fixes Needed: " << numberOfNoDeletionFixesNeeded << "\n"; // Print out the number of deletions without any fixes needed
+	insertDepths.display("Insert Depths"); // Print out how many nodes each insert looked at
+
+	// Print out where the ten most frequent words are, which is where most of the inserts went.
+	displayWordDepths("Top Word Depths", topK(10), [this](const char* word) { return depthOf(word); });
 }
\ No newline at end of file
@@ -14,6 +14,13 @@
 
 #include <iostream>
 #include "time.h"
+#include "Statistics.h"
+#include "MemoryUsage.h"
+#include "Prefetch.h"
+#include "WordQuery.h"
+#include "DepthHistogram.h"
+#include "FrozenTree.h"
+#include "SeqLock.h"
 
 using namespace std;
 
@@ -24,19 +31,106 @@ public:
 	~RBT();
 
 	void insert(const char word[50]); // adds a word to the tree
+	bool remove(const char word[50]); // removes a word from the tree no matter its count, returning false if it wasn't there
+	bool decrement(const char word[50]); // lowers a word's count by one, removing it at zero, returning false if it wasn't there
 	void list(); // Prints a list of all words in the tree.
 	void displayStatistics(); // Displays statistics about the tree operations performed.
+
+	// Adds every word of the other tree to this one, along with its count, in O(n + m) time, leaving
+	// this tree perfectly balanced. The other tree isn't changed.
+	void merge(const RBT& other);
+
+	// Checks every invariant of the tree in O(n) time without recursion, printing the first one that
+	// is broken. Returns true if it is valid.
+	bool validate() const;
+
+	// Returns the number of times the word has been inserted, or zero if it isn't in the tree
+	unsigned int find(const char word[50]);
+
+	// Looks up many words at once, setting counts[i] to what find(words[i]) would return. With
+	// prefetching on, several lookups are interleaved so that their cache misses overlap.
+	void findBatch(const char* const words[], size_t numberOfWords, unsigned int counts[]);
+
+	// Turns prefetching of both children during inserts and lookups on or off. It is off by default.
+	void setPrefetching(bool enabled);
+
+	unsigned long long getKeyComparisons(); // Returns the number of key comparisons made so far
+	unsigned long long getReferenceChanges(); // Returns the number of reference changes made so far
+	unsigned int getHeight(); // Returns the height of the tree
+	unsigned long long getMemoryUsage(); // Returns the number of bytes taken up by the nodes of the tree
+	unsigned long long getAllocatedBytes(); // Returns the number of bytes the allocator set aside for the nodes of the tree, including removed ones waiting to be reused
+	unsigned long long getFreeListBytes(); // Returns the number of those bytes that belong to removed nodes on the free list
+	const DepthHistogram& getLookupDepths() const; // Returns the depths of every find so far
 private:
 	struct node
 	{
-		char word[50] = {};			// The word of the node
-		unsigned int count = 1;		// The amount of times the word has been inserted into the binary search tree
-		bool color = RED;			// The color of the node. Since we only have two possible colors, red or black, it is just a bool.
-		node* parent = nullptr;		// A pointer to the parent of the node
-		node* leftChild = nullptr;	// A pointer to the left child of the node
-		node* rightChild = nullptr;	// A pointer to the right child of the node
+		char word[50] = {};							// The word of the node, which readers on other threads only read through compareWord and loadWord
+		SharedField<unsigned int> count = 1;		// The amount of times the word has been inserted into the binary search tree
+		bool color = RED;							// The color of the node. Since we only have two possible colors, red or black, it is just a bool.
+		unsigned int size = 1;						// The number of nodes in the subtree rooted at this node, including itself (nil's is zero)
+		node* parent = nullptr;						// A pointer to the parent of the node
+		SharedField<node*> leftChild = nullptr;		// A pointer to the left child of the node
+		SharedField<node*> rightChild = nullptr;	// A pointer to the right child of the node
 	};
 
+public:
+	// An iterator that walks through the words of the tree in alphabetical order.
+	// Since our nodes have parent pointers, it only has to remember the node it is on.
+	class iterator
+	{
+	public:
+		WordCount operator*() const;					// Returns the word and count of the node the iterator is on
+		iterator& operator++();							// Moves the iterator on to the next word in alphabetical order
+		bool operator==(const iterator& other) const;	// Two iterators are equal if they are on the same node
+		bool operator!=(const iterator& other) const;
+	private:
+		friend class RBT;
+
+		node* current = nullptr;	// The node the iterator is on, or nullptr if it is at the end
+		node* nil = nullptr;		// The nil node of the tree we are walking through
+		WordBound bound;			// Where the iteration stops
+	};
+
+	WordRange<iterator> words() const; // Returns every word in the tree, in alphabetical order
+	WordRange<iterator> rangeQuery(const char* lo, const char* hi) const; // Returns the words from lo to hi, including lo and hi
+	WordRange<iterator> prefixQuery(const char* prefix) const; // Returns the words that start with the given prefix
+	vector<WordCount> topK(size_t k) const; // Returns the k most frequent words in the tree, most frequent first
+
+	// Returns the number of words in the tree that come before the given word alphabetically, which is
+	// the word's index (counting from 0) if it is in the tree. This takes O(log n) time.
+	size_t rank(const char word[50]) const;
+
+	// Returns the word at the given index (counting from 0) in alphabetical order, or a null word with a
+	// count of zero if the tree doesn't have that many words. This takes O(log n) time.
+	WordCount select(size_t index) const;
+
+	// Returns the count words starting at the given index in alphabetical order, so that a listing can
+	// be paged through without walking from the first word every time.
+	WordRange<iterator> page(size_t index, size_t count) const;
+
+	// Copies the next page of up to capacity words (and their counts), in alphabetical order, into the
+	// buffer, starting after the cursor's last word, and moves the cursor along. Finding where the page
+	// starts takes O(log n) time, however far into the listing the cursor is. Returns the number of
+	// words copied, which is zero once the cursor has gone past the last word.
+	size_t nextPage(WordCursor& cursor, WordEntry* buffer, size_t capacity) const;
+
+	// Looks up a word the same way find does, except that any number of threads can call this while
+	// one other thread inserts, removes, decrements or merges. Whenever the tree changes under the
+	// lookup, it starts over, adding one to retries (if it isn't nullptr). This doesn't count toward
+	// any statistics, so that readers never write to anything the other threads share.
+	unsigned int concurrentFind(const char word[50], unsigned long long* retries = nullptr) const;
+
+	// Takes the next page of words the same way nextPage does, except that it is safe to call while
+	// another thread changes the tree, just like concurrentFind.
+	size_t concurrentNextPage(WordCursor& cursor, WordEntry* buffer, size_t capacity, unsigned long long* retries = nullptr) const;
+
+	// Returns a read-only copy of the tree laid out in one array for faster lookups. The copy
+	// belongs to the caller and doesn't change when this tree does.
+	FrozenTree* freeze() const;
+private:
+	// Returns an iterator on the first word that isn't less than lo (or the first word if lo is nullptr) which stops at the given bound
+	iterator lowerBound(const char* lo, const WordBound& bound) const;
+
 	// As seen from our node struct above, the node color is a boolean, so we just make RED false and BLACK true.
 	// We will always refer to these colors with these constant static RED and BLACK variables instead of true or false.
 	const static bool RED = false;
@@ -44,17 +138,26 @@ private:
 
 	void traverseDestruct(node* p); // Traverses through the given node and deletes its children recursively as well as itself
 
+	node* allocateNode(); // Returns a fresh node, reusing one from the free list if we have one
+	void releaseNode(node* p); // Puts a node that was removed from the tree onto the free list
+
+	// Links the given nodes, which are in alphabetical order, into a perfectly balanced subtree from first up to
+	// (but not including) last under the given parent, coloring the nodes deeper than fullLevels red. Returns its root.
+	node* buildBalanced(vector<node*>& nodes, size_t first, size_t last, node* parent, int depth, int fullLevels);
+
 	// Calculates the number of words and unique words in the RBT tree.
-	void calculateNumWords(unsigned int& numWords, unsigned int& numUniqueWords);
+	void calculateNumWords(unsigned long long& numWords, unsigned long long& numUniqueWords);
 
 	// Recursively calculates the number of words and unique words by counting the given node's words and its two children.
-	void calculateNumWords(node* p, unsigned int& numWords, unsigned int& numUniqueWords);
+	void calculateNumWords(node* p, unsigned long long& numWords, unsigned long long& numUniqueWords);
 
-	void list(int& index, node* p);	// Traverses through the children of a node as well as the node and prints
 	void leftRotate(node* p);		// Performs a left rotation on the given node
 	void rightRotate(node* p);		// Performs a right rotation on the given node
 	void insertFixup(node* p);		// Fixes up the insertion into the tree of the given node by performing rotations and recoloring nodes as needed.
-	unsigned int getHeight();		// Returns the height of the tree
+	node* search(const char word[50]);	// Returns the node with the given word, or nil if the word isn't in the tree
+	void transplant(node* u, node* v);	// Replaces the subtree rooted at u with the subtree rooted at v
+	void removeNode(node* z);			// Deletes the given node from the tree and releases it
+	void deleteFixup(node* x);			// Fixes up the tree after a deletion left an extra black at the given node
 
 	// Recursively calculates the height of the tree by traversing through the given node and its children
 	void calculateHeight(node* p, unsigned int& height, unsigned int traversalHeight);
@@ -62,7 +165,7 @@ private:
 	// A pointer to the root of the binary search tree. While this is first set to nullptr,
 	// it will point to the nil node pointer below after the constructor has been called.
 	// If this points to the same node that nil points to, no nodes exist in the tree.
-	node* root = nullptr;
+	SharedField<node*> root = nullptr;
 
 	// A pointer to a nil node that we will set up in the constructor. nil is a special node,
 	// who's parent, left child, and right child are all nil. It is used instead of nullptr
@@ -70,13 +173,32 @@ private:
 	// easier to implement.
 	node* nil = nullptr;
 
-	unsigned long long numberOfRecolorings = 0;			// Keeps track of the number of times a node gets recolored.
-	unsigned long long numberOfReferenceChanges = 0;	// Keeps track of the number of times the root pointer or child pointers change.
-	unsigned long long numberOfKeyComparisonsMade = 0;	// Keeps track of the number of word key comparisons during tree inserts.
-	unsigned long long numberOfNoFixesNeeded = 0;		// Keeps track of the number of times a new node is inserted without a fix performed on the tree.
-	unsigned long long numberOfLeftRotations = 0;		// Keeps track of the number of left rotations made on new node insertion.
-	unsigned long long numberOfRightRotations = 0;		// Keeps track of the number of right rotations made on new node insertion.
-	unsigned long long numberOfCase1Fixes = 0;			// Keeps track of the number of times a case 1 fix is performed on new node insertion.
-	unsigned long long numberOfCase2Fixes = 0;			// Keeps track of the number of times a case 2 fix is performed on new node insertion.
-	unsigned long long numberOfCase3Fixes = 0;			// Keeps track of the number of times a case 3 fix is performed on new node insertion.
+	node* freeList = nullptr; // A list of removed nodes, linked through their left child pointers and ending in nil, that we reuse before allocating new ones.
+	bool prefetching = false; // Whether or not we prefetch both children of each node we pass on the way down
+	SeqLock seqLock; // Tells readers on other threads when we are changing the tree
+
+	// Returns the depth of the word's node, counting the root as 1, or zero if it isn't in the tree. This doesn't count toward any statistics.
+	unsigned int depthOf(const char* word) const;
+
+	DepthHistogram insertDepths; // How many nodes each insert compared its word against, whether it found the word or added it
+	DepthHistogram lookupDepths; // How many nodes each find compared its word against
+
+	statistic numberOfRecolorings = 0;				// Keeps track of the number of times a node gets recolored.
+	statistic numberOfReferenceChanges = 0;			// Keeps track of the number of times the root pointer or child pointers change.
+	statistic numberOfKeyComparisonsMade = 0;		// Keeps track of the number of word key comparisons during tree inserts and deletions.
+	statistic numberOfNoFixesNeeded = 0;			// Keeps track of the number of times a new node is inserted without a fix performed on the tree.
+	statistic numberOfLeftRotations = 0;			// Keeps track of the number of left rotations made on new node insertion.
+	statistic numberOfRightRotations = 0;			// Keeps track of the number of right rotations made on new node insertion.
+	statistic numberOfCase1Fixes = 0;				// Keeps track of the number of times a case 1 fix is performed on new node insertion.
+	statistic numberOfCase2Fixes = 0;				// Keeps track of the number of times a case 2 fix is performed on new node insertion.
+	statistic numberOfCase3Fixes = 0;				// Keeps track of the number of times a case 3 fix is performed on new node insertion.
+	statistic numberOfDeletions = 0;				// Keeps track of the number of nodes removed from the tree.
+	statistic numberOfDeletionRecolorings = 0;		// Keeps track of the number of times a node gets recolored during a deletion.
+	statistic numberOfDeletionLeftRotations = 0;	// Keeps track of the number of left rotations made during deletions.
+	statistic numberOfDeletionRightRotations = 0;	// Keeps track of the number of right rotations made during deletions.
+	statistic numberOfDeletionCase1Fixes = 0;		// Keeps track of the number of times a case 1 fix is performed during a deletion.
+	statistic numberOfDeletionCase2Fixes = 0;		// Keeps track of the number of times a case 2 fix is performed during a deletion.
+	statistic numberOfDeletionCase3Fixes = 0;		// Keeps track of the number of times a case 3 fix is performed during a deletion.
+	statistic numberOfDeletionCase4Fixes = 0;		// Keeps track of the number of times a case 4 fix is performed during a deletion.
+	statistic numberOfNoDeletionFixesNeeded = 0;	// Keeps track of the number of times a node is deleted without a fix performed on the tree.
 };
\ No newline at end of file
@@ -0,0 +1,196 @@
+//==============================================================================================
+// File: ScalingReport.cpp - Scaling benchmark report implementation
+// c.f.: ScalingReport.h
+//
+// This class collects the results of running every datatype over inputs of growing size and
+// presents them three ways. The raw numbers are printed as comma separated values, so they
+// can be charted elsewhere. For each datatype, we fit a line through the cost per insert
+// against log2(n): a balanced tree's comparisons per insert should grow by about one for each
+// doubling of n, so the slope of that line says how close to the ideal each datatype is, and a
+// time per insert that grows faster than its comparisons do is a sign of cache misses. Finally,
+// we draw the curves as a small text plot so the shape is visible without any other tools.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "ScalingReport.h"
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+void ScalingReport::add(const measurement& m)
+{
+	measurements.push_back(m);
+
+	for (const char* datatype : datatypes) // If we have seen this datatype before, we are done.
+	{
+		if (strcmp(datatype, m.datatype) == 0)
+		{
+			return;
+		}
+	}
+
+	datatypes.push_back(m.datatype); // Otherwise, we remember it.
+}
+
+double ScalingReport::valueOf(const measurement& m, bool comparisons)
+{
+	if (m.size == 0)
+	{
+		return 0;
+	}
+
+	return comparisons ? (double)m.keyComparisons / m.size : m.seconds * 1e9 / m.size;
+}
+
+void ScalingReport::printCsv(ostream& out)
+{
+	out << "datatype,words,seconds,ns_per_insert,key_comparisons,comparisons_per_insert,reference_changes,height,memory_bytes\n";
+
+	for (const measurement& m : measurements)
+	{
+		out << m.datatype << "," << m.size << "," << m.seconds << "," << valueOf(m, false) << ","
+			<< m.keyComparisons << "," << valueOf(m, true) << "," << m.referenceChanges << ","
+			<< m.height << "," << m.memory << "\n";
+	}
+}
+
+void ScalingReport::printFits()
+{
+	// This method fits y = a + b * log2(n) through each datatype's measurements with least
+	// squares. With x = log2(n), the slope is b = (k Sxy - Sx Sy) / (k Sxx - Sx Sx) and the
+	// intercept is a = (Sy - b Sx) / k, where k is the number of sizes and S is a sum over them.
+	// We also print r squared, which tells us how well a straight line describes the curve.
+	//
+	cout << "Least Squares Fits (against log2 of the number of words):\n";
+
+	for (int comparisons = 0; comparisons < 2; comparisons++)
+	{
+		for (const char* datatype : datatypes)
+		{
+			double k = 0, sx = 0, sy = 0, sxx = 0, sxy = 0, syy = 0;
+
+			for (const measurement& m : measurements) // We add up the sums over this datatype's sizes.
+			{
+				if (strcmp(m.datatype, datatype) != 0 || m.size == 0)
+				{
+					continue;
+				}
+
+				double x = log2((double)m.size);
+				double y = valueOf(m, comparisons != 0);
+
+				k++;
+				sx += x;
+				sy += y;
+				sxx += x * x;
+				sxy += x * y;
+				syy += y * y;
+			}
+
+			double denominator = k * sxx - sx * sx;
+
+			if (k < 2 || denominator == 0) // We need at least two different sizes to fit a line.
+			{
+				continue;
+			}
+
+			double slope = (k * sxy - sx * sy) / denominator;
+			double intercept = (sy - slope * sx) / k;
+
+			double totalVariance = k * syy - sy * sy;
+			double rSquared = totalVariance == 0 ? 1 : (k * sxy - sx * sy) * (k * sxy - sx * sy) / (denominator * totalVariance);
+
+			cout << "  " << datatype << (comparisons ? " comparisons per insert = " : " ns per insert = ")
+				<< intercept << " + " << slope << " log2(n), r^2 = " << rSquared << "\n";
+		}
+	}
+}
+
+void ScalingReport::plot(bool comparisons)
+{
+	// This method draws the value of every measurement on a grid of characters, with log2(n)
+	// across and the value up. Each datatype is drawn with the first letter of its name, and
+	// a spot where two datatypes land on top of each other is drawn with a star.
+	//
+	const int WIDTH = 64;	// The number of columns in the plot
+	const int HEIGHT = 16;	// The number of rows in the plot
+
+	if (measurements.empty())
+	{
+		return;
+	}
+
+	double minX = 0, maxX = 0, maxY = 0;
+	bool first = true;
+
+	for (const measurement& m : measurements) // We find the range of our axes.
+	{
+		if (m.size == 0)
+		{
+			continue;
+		}
+
+		double x = log2((double)m.size);
+
+		if (first || x < minX) minX = x;
+		if (first || x > maxX) maxX = x;
+		if (valueOf(m, comparisons) > maxY) maxY = valueOf(m, comparisons);
+
+		first = false;
+	}
+
+	if (maxY <= 0)
+	{
+		maxY = 1;
+	}
+
+	char grid[HEIGHT][WIDTH + 1];
+
+	for (int row = 0; row < HEIGHT; row++) // We start with an empty grid,
+	{
+		memset(grid[row], ' ', WIDTH);
+		grid[row][WIDTH] = 0;
+	}
+
+	for (const measurement& m : measurements) // and put each measurement's letter in its spot.
+	{
+		if (m.size == 0)
+		{
+			continue;
+		}
+
+		double x = log2((double)m.size);
+		int column = maxX > minX ? (int)((x - minX) / (maxX - minX) * (WIDTH - 1) + 0.5) : 0;
+		int row = HEIGHT - 1 - (int)(valueOf(m, comparisons) / maxY * (HEIGHT - 1) + 0.5);
+
+		char& spot = grid[row][column];
+
+		spot = (spot == ' ' || spot == m.datatype[0]) ? m.datatype[0] : '*';
+	}
+
+	cout << (comparisons ? "Comparisons per Insert" : "ns per Insert") << " vs. log2(n):\n";
+
+	for (int row = 0; row < HEIGHT; row++) // We print the grid with the value of the top and bottom rows on the side.
+	{
+		char label[16] = "";
+
+		if (row == 0)
+		{
+			snprintf(label, sizeof(label), "%.1f", maxY);
+		}
+		else if (row == HEIGHT - 1)
+		{
+			snprintf(label, sizeof(label), "0");
+		}
+
+		cout.width(10);
+		cout << label << " |" << grid[row] << "\n";
+	}
+
+	cout << "           +" << string(WIDTH, '-') << "\n";
+	cout << "            log2(n) = " << minX << " to " << maxX << "\n";
+}
@@ -0,0 +1,47 @@
+//==============================================================================================
+// File: ScalingReport.h - Scaling benchmark report
+// Header for ScalingReport.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+class ScalingReport
+{
+public:
+	// One datatype's results for one size of input.
+	struct measurement
+	{
+		const char* datatype;					// The name of the datatype
+		unsigned long long size;				// The number of words inserted
+		double seconds;							// How long inserting them took, with the dry run taken out
+		unsigned long long keyComparisons;		// The number of key comparisons made
+		unsigned long long referenceChanges;	// The number of reference changes made
+		unsigned int height;					// The height of the datatype afterwards
+		unsigned long long memory;				// The number of bytes the datatype's nodes take up afterwards
+	};
+
+	void add(const measurement& m); // Adds one datatype's results for one size to the report
+
+	void printCsv(ostream& out); // Prints every measurement as comma separated values, one per line
+	void printFits(); // Prints the least squares line through ns per insert and comparisons per insert against log2(n) for each datatype
+	void plot(bool comparisons); // Plots ns per insert (or comparisons per insert) against log2(n) for every datatype
+private:
+	// Returns the value we fit and plot for a measurement, which is ns per insert or comparisons per insert.
+	static double valueOf(const measurement& m, bool comparisons);
+
+	vector<measurement> measurements;	// Every measurement, in the order they were added
+	vector<const char*> datatypes;		// The name of every datatype, in the order we first saw them
+};
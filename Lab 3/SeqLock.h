@@ -0,0 +1,175 @@
+//==============================================================================================
+// File: SeqLock.h - A sequence lock for one writer and many optimistic readers
+//
+// The balanced trees can be read by many threads while one thread keeps changing them, using
+// one of these per tree. The writer never waits: it bumps the sequence number to an odd number
+// before it changes the tree and to the next even number once it is done. A reader never
+// blocks the writer either: it notes the sequence number, walks the tree without any lock,
+// and then checks the sequence number again. If it changed (or was odd to begin with), the
+// writer was busy while we read, so what we read can't be trusted, and the reader starts over.
+// Readers don't write to anything shared, so adding readers doesn't slow the others down.
+//
+// A reader can run into a node the writer is in the middle of changing, or one it just took
+// out of the tree. That is only safe because the trees never give a removed node back to the
+// allocator while they are alive: it goes on their free list and comes back as another node.
+// A new node's children are set before it is linked in, and the free lists end the same way the
+// tree does, so every child pointer a reader follows is either a node or the tree's own end
+// marker (nil for the RBT, nullptr for the AVL tree), which is the only thing a reader stops at.
+// A reader that gets lost can go around in circles, though, so readers give up and start over
+// once they have taken more steps than any tree could be tall.
+//
+// The reader and the writer still touch the same fields at the same time, which C++ only allows
+// for atomics. So every node field a reader looks at (its word, count and children) and the root
+// are read and written through atomics. Fields are stored with release and loaded with acquire,
+// so a reader that gets to a node through a pointer the writer just stored also sees everything
+// the writer did to that node first, including making it. On x86, those are the same plain moves
+// as before; they just tell the compiler the race is on purpose. The sequence lock's fences are
+// what make a reader see a whole write or notice it didn't.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+using namespace std;
+
+// The most nodes a reader goes through on one trip down a tree before it decides that the
+// writer must have moved things around under it. Neither balanced tree gets anywhere near
+// this tall (an AVL tree of a billion words is at most 43 nodes tall, and an RBT at most 60).
+const int OPTIMISTIC_STEP_LIMIT = 256;
+
+// A node field (or root pointer) that readers look at while the writer might be changing it.
+// It reads and writes like the plain field it replaces, but every store is an atomic release
+// and every load an atomic acquire. Only one thread ever writes, so the operators that change
+// the value can load it and store it back instead of needing a read-modify-write.
+template <class T>
+class SharedField
+{
+public:
+	SharedField(T value = T()) : value(value) {}
+	SharedField(const SharedField& other) : value(other.load()) {}
+
+	SharedField& operator=(const SharedField& other) { store(other.load()); return *this; }
+	SharedField& operator=(T value) { store(value); return *this; }
+
+	operator T() const { return load(); }
+	T operator->() const { return load(); } // For pointers, so that p->leftChild->word still works
+
+	T operator++(int) { T old = load(); store(old + 1); return old; }
+	T operator--(int) { T old = load(); store(old - 1); return old; }
+	SharedField& operator+=(T amount) { store(load() + amount); return *this; }
+
+	T load() const { return value.load(memory_order_acquire); }
+	void store(T value) { this->value.store(value, memory_order_release); }
+private:
+	atomic<T> value;
+};
+
+// Words are read and written a byte at a time through relaxed atomics for the same reason. A new
+// word is written before the pointer that leads readers to its node, which orders it, and a reader
+// that catches a word being overwritten finds out from the sequence lock. C++17 has no atomic view
+// of a plain char array (that is C++20's atomic_ref), so we look at each byte through an
+// atomic<char>, which is exactly a char that never needs a lock. Only the writer's stores into a
+// node's word and the readers' loads from one go through these; the writer's own reads of a word
+// don't race with anything, since nobody else writes it.
+static_assert(sizeof(atomic<char>) == 1 && ATOMIC_CHAR_LOCK_FREE == 2, "a word's bytes have to be readable as lock-free atomics");
+
+inline void storeWord(char word[50], const char* source) // Copies the source into a node's word, like strcpy
+{
+	atomic<char>* bytes = reinterpret_cast<atomic<char>*>(word);
+	int i = 0;
+
+	for (; i < 49 && source[i] != 0; i++)
+	{
+		bytes[i].store(source[i], memory_order_relaxed);
+	}
+
+	bytes[i].store(0, memory_order_relaxed);
+}
+
+inline int compareWord(const char* key, const char word[50]) // Compares the key to a node's word, like strcmp
+{
+	const atomic<char>* bytes = reinterpret_cast<const atomic<char>*>(word);
+
+	for (int i = 0; i < 50; i++) // A word the writer is halfway through might not end, so we stop at 50 bytes either way.
+	{
+		unsigned char a = (unsigned char)key[i];
+		unsigned char b = (unsigned char)bytes[i].load(memory_order_relaxed);
+
+		if (a != b || a == 0)
+		{
+			return (int)a - (int)b;
+		}
+	}
+
+	return 0;
+}
+
+inline void loadWord(char copy[50], const char word[50]) // Copies a node's word out, like strcpy
+{
+	const atomic<char>* bytes = reinterpret_cast<const atomic<char>*>(word);
+	int i = 0;
+
+	for (; i < 49 && (copy[i] = bytes[i].load(memory_order_relaxed)) != 0; i++)
+	{
+	}
+
+	copy[i] = 0;
+}
+
+class SeqLock
+{
+public:
+	// While one of these is around, the writer is changing the tree. It is made at the top of
+	// every method that changes the tree, so that every way out of the method ends the write.
+	class writeSection
+	{
+	public:
+		writeSection(SeqLock& lock) : lock(lock)
+		{
+			unsigned long long sequence = lock.sequence.load(memory_order_relaxed);
+
+			lock.sequence.store(sequence + 1, memory_order_relaxed); // An odd number tells readers we are writing,
+			atomic_thread_fence(memory_order_release); // and it has to be visible before anything we change is.
+		}
+
+		~writeSection()
+		{
+			// Everything we changed is visible before the even number that says we are done.
+			lock.sequence.store(lock.sequence.load(memory_order_relaxed) + 1, memory_order_release);
+		}
+	private:
+		SeqLock& lock;
+	};
+
+	// Returns the sequence number a read starts at, waiting for the writer to finish first if it
+	// is in the middle of a change.
+	unsigned long long beginRead() const
+	{
+		unsigned long long sequence;
+
+		while ((sequence = this->sequence.load(memory_order_acquire)) & 1)
+		{
+			this_thread::yield(); // The writer is busy, so we let it run instead of spinning against it.
+		}
+
+		return sequence;
+	}
+
+	// Returns true if nothing was written since the read that began at the given sequence number,
+	// which means everything it read was a consistent view of the tree.
+	bool endRead(unsigned long long sequence) const
+	{
+		atomic_thread_fence(memory_order_acquire); // Everything we read has to be read before we check again.
+
+		return this->sequence.load(memory_order_relaxed) == sequence;
+	}
+private:
+	atomic<unsigned long long> sequence{ 0 }; // Odd while the writer is changing the tree, even otherwise
+};
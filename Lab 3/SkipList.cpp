@@ -5,6 +5,8 @@
 // This class implements a Skip list, filled with nodes as declared in SkipList.h.  
 // Each node contains a word, the number of times the word has appeared, pointers to 
 // the left, right, up and down nodes, and a boolean representing whether a node is sentinel.
+// Each node also knows its width, the number of slow lane nodes its right pointer skips over
+// (counting the one it lands on), so adding up the widths along a search gives a word's index.
 // This datatype does not perform any rotations like the trees in this project, but instead is
 // a lane system where nodes are inserted into fast lanes above the slow lane based on a coin flip.
 //
@@ -16,7 +18,14 @@
 
 #include "SkipList.h"
 
-SkipList::SkipList()
+SkipList::SkipList() : SkipList((unsigned long long)time(NULL))
+{
+	// constructor -- we just seed our level generator with the current time, like
+	// we always have, and let the constructor below do the rest of the work.
+	//
+}
+
+SkipList::SkipList(unsigned long long seed, double promotionProbability, int maxLevel)
 {
 	// constructor -- we initialize the head and tail nodes of our skip list.
 	// We also intialize the number of items to zero and the height of the list
@@ -32,9 +41,41 @@ SkipList::SkipList()
 	numberOfItems = 0;	// We start with zero items in the list.
 	height = 1;			// We also start with a height of 1, as we only have one lane in the skip list in the beginning.
 
-	// We construct a Mersenne Twister Engine to handle our
-	// random number generation, seeding it with the current time.
-	coin = mt19937(time(NULL));
+	// We construct a 64-bit Mersenne Twister Engine to handle our random
+	// number generation, seeding it with the given seed so that runs with
+	// the same seed build exactly the same list.
+	this->seed = seed;
+	levelGenerator = mt19937_64(seed);
+
+	// Each promotion needs promotionBits more zero bits at the bottom of a random word, so a
+	// probability of one half takes one bit, one quarter takes two bits, and so on. We round
+	// the probability we were given to the closest one of those, keeping at least one bit
+	// and at most 16, since 64 bits wouldn't be enough for any real tower after that. Anything
+	// outside of (0, 1), NaN included, is clamped before it gets near log2, whose answer for
+	// those (infinity or NaN) can't be turned into an int.
+	if (!(promotionProbability < 1.0)) // A probability of one or more (or NaN) promotes as often as we can.
+	{
+		promotionBits = 1;
+	}
+	else if (!(promotionProbability > 1.0 / (1 << 16))) // One of zero or less promotes as rarely as we can.
+	{
+		promotionBits = 16;
+	}
+	else
+	{
+		promotionBits = (int)(-log2(promotionProbability) + 0.5);
+
+		if (promotionBits < 1)
+		{
+			promotionBits = 1;
+		}
+		else if (promotionBits > 16)
+		{
+			promotionBits = 16;
+		}
+	}
+
+	this->maxLevel = maxLevel < 1 ? 1 : maxLevel; // Every tower has at least the slow lane.
 }
 
 SkipList::~SkipList()
@@ -63,6 +104,39 @@ SkipList::~SkipList()
 
 		delete del;		// and delete our deletion pointer.
 	}
+
+	while (freeList != nullptr) // Finally, we delete every node waiting on the free list.
+	{
+		node* del = freeList;
+		freeList = freeList->right;
+		delete del;
+	}
+}
+
+SkipList::node* SkipList::allocateNode()
+{
+	// This method hands out a node for insert to use. If a node was removed
+	// earlier, we take it off of the free list and reset it instead of asking
+	// the allocator for a new one.
+	//
+	if (freeList == nullptr)	// If there are no free nodes,
+	{
+		return new node();		// we have to make a new one.
+	}
+
+	node* p = freeList;			// Otherwise, we take the first free node,
+	freeList = freeList->right;	// move the free list along,
+
+	*p = node();				// and reset the node back to its defaults.
+
+	return p;
+}
+
+void SkipList::releaseNode(node* p)
+{
+	// This method puts a node that was removed from the list at the front of the free list.
+	p->right = freeList;
+	freeList = p;
 }
 
 SkipList::node* SkipList::createSentinelNode()
@@ -71,23 +145,26 @@ SkipList::node* SkipList::createSentinelNode()
 	// so that we don't have to repeatedly set isSentinel on construction
 	// of a sentinel node.
 	//
-	node* newNode = new node(); // We construct a new node,
+	node* newNode = allocateNode(); // We get a new node,
 
 	newNode->isSentinel = true;	// mark it as sentinel,
 
 	return newNode;				// and return the node pointer.
 }
 
-SkipList::node* SkipList::search(const char word[50], bool& found)
+SkipList::node* SkipList::search(const char word[50], bool& found, size_t& depth)
 {
 	// This method searches through the skip list for a node in the slow lane with
 	// the given word. If a node with the word is found, it is returned and the
 	// boolean found will be set to true. If it is not found, the method will return
 	// the node just before where the one we are looking for would be if it was in the
-	// list.
+	// list. depth counts the nodes we compare against, so that an unlucky set of
+	// towers shows up as a long search.
 	// This searching code is from an e-mail he sent, check it when doing commenting - email sent on Tuesday, March 24
 	node* p = head; // Start at the head since we will be searching from the beginning of the list
 
+	depth = 0;
+
 	while (true) // We want to loop until we find a node.
 	{
 		while (!p->right->isSentinel) // While the node to the right of p is not a sentinel node,
@@ -95,6 +172,7 @@ SkipList::node* SkipList::search(const char word[50], bool& found)
 			int compareValue = strcmp(p->right->word, word); // compare the right pointer's word to the word we are looking for.
 
 			numberOfKeyComparisonsMade++; // Increment our key comparisons since we just made one
+			depth++;
 
 			if (compareValue < 0)	// If the right pointer's word is less than our word,
 			{
@@ -133,6 +211,56 @@ SkipList::node* SkipList::search(const char word[50], bool& found)
 	}
 }
 
+size_t SkipList::depthOf(const char* word) const
+{
+	// This method searches the same way search does, counting comparisons instead of returning a node.
+	//
+	node* p = head;
+	size_t depth = 0;
+
+	while (true)
+	{
+		while (!p->right->isSentinel)
+		{
+			int compareValue = strcmp(p->right->word, word);
+
+			depth++;
+
+			if (compareValue == 0)
+			{
+				return depth;
+			}
+
+			if (compareValue > 0)
+			{
+				break;
+			}
+
+			p = p->right;
+		}
+
+		if (p->down == nullptr)
+		{
+			return 0;
+		}
+
+		p = p->down;
+	}
+}
+
+int SkipList::randomLevel()
+{
+	// This method picks the height of a new node's tower. Flipping a coin for each
+	// level costs a full random number per flip, so instead we draw one 64-bit
+	// random word and count its trailing zero bits. Every group of promotionBits
+	// zero bits at the bottom of the word is one promotion, which happens with
+	// probability 2^-promotionBits, exactly like a run of heads coin tosses.
+	//
+	int level = 1 + countTrailingZeros(levelGenerator()) / promotionBits;
+
+	return level < maxLevel ? level : maxLevel; // We never let a tower grow past our max level.
+}
+
 void SkipList::insert(const char word[50])
 {
 	// To add a word to the list, we need to traverse through each lane looking for node,
@@ -144,9 +272,12 @@ void SkipList::insert(const char word[50])
 	// Define a variable that we can pass by reference that represents if a node with
 	// the given word was found in the list or not
 	bool found;
+	size_t depth; // The number of nodes the search compared our word against
 
 	// Finds a node with the given word, returning either that node or the node right before where it would be
-	node* p = search(word, found);
+	node* p = search(word, found, depth);
+
+	insertDepths.record(depth);
 
 	if (found)		// If we found the word in the list,
 	{
@@ -155,7 +286,7 @@ void SkipList::insert(const char word[50])
 		return;		// and that's it!
 	}
 
-	node* newNode = new node(); // We didn't find a node with the word so we need to create one.
+	node* newNode = allocateNode(); // We didn't find a node with the word so we need to create one.
 
 	strcpy(newNode->word, word); // Copy the word we are inserting into the new node's word
 
@@ -172,15 +303,19 @@ void SkipList::insert(const char word[50])
 
 	numberOfItems++; // We've added a new item to the list, so we increment this by one.
 
+	// newNode's left neighbour in the slow lane is one step before it, which it already says,
+	// since every slow lane node has a width of one.
 	int currentHeight = 1; // We declare a variable to keep track of which lane we are adding a node to.
 
-	while (coin() & 1) // Get a random value and check if its odd, simulating a coin flip.
+	int level = randomLevel(); // We decide how tall our new node's tower will be all at once.
+
+	while (currentHeight < level) // While our tower isn't as tall as it should be,
 	{
 		// We increment our current height by one, since we now need to add a node to the lane above our previous one.
 		currentHeight++;
 		numberOfHeadsCoinTosses++;		// We increment our counter of coin tosses that resulted in heads.
 
-		node* pileNode = new node();	// Construct a node that we will pile on top of our new node.
+		node* pileNode = allocateNode();	// Construct a node that we will pile on top of our new node.
 
 		pileNode->down = newNode;		// Since our pile node is above our new node, we set its down pointer
 		newNode->up = pileNode;			// and new node's up pointer to the pile node.
@@ -189,6 +324,18 @@ void SkipList::insert(const char word[50])
 
 		strcpy(pileNode->word, word);	// We copy our word into pile node's word.
 
+		// The node before our pile node in the lane above is on the first column to our left that is
+		// tall enough, or the head if there isn't one. We walk left to it through the lane we are in,
+		// adding up widths as we go, to find how many slow lane steps it is behind our new word.
+		node* column = newNode;
+		unsigned int distance = 0;
+
+		do
+		{
+			column = column->left;
+			distance += column->width;
+		} while (column->up == nullptr && column->left != nullptr);
+
 		// If our current height is bigger than our tree's total height, we
 		// need to create a new top lane before we can add anything to it!
 		if (currentHeight > height)
@@ -205,6 +352,9 @@ void SkipList::insert(const char word[50])
 			tail->up = positiveNode;		// Our tail node is below our positive node, so we set its up pointer.
 			numberOfReferenceChanges += 2;	// Since we've changed two references, we increment our counter by two.
 
+			negativeNode->width = distance;	// Since we walked all the way to the head, distance is our word's place in the list,
+			pileNode->width = numberOfItems + 1 - distance; // and the rest of the list is between our pile node and the tail.
+
 			negativeNode->right = pileNode;	// Our negative node is to the left of our pile node, so we  set its right pointer.
 			pileNode->left = negativeNode;	// Our pile node is to the right of our negative node, so we set its left pointer.
 			positiveNode->left = pileNode;	// Our positive node is to the right of our pile node, so we set its left pointer.
@@ -242,10 +392,145 @@ void SkipList::insert(const char word[50])
 			rightNode->up->left = pileNode;		// and the node above our right node's left node becomes the pile node as well.
 
 			numberOfReferenceChanges += 4;		// We've changed four references, so we increment our counter.
+
+			// The node above our left node used to skip all the way to the node above our right node, which
+			// is one step further now. Our pile node takes over the part of that after our new word.
+			pileNode->width = leftNode->up->width + 1 - distance;
+			leftNode->up->width = distance;
 		}
 
 		newNode = pileNode; // We set our new node to the pile node so that the next node we construct properly stacks on top of it.
 	}
+
+	// In every lane above our tower, the node that skips over our new word has one more step to take.
+	changeWidthsAbove(newNode, 1);
+}
+
+void SkipList::changeWidthsAbove(node* p, int change)
+{
+	// This method finds the node that skips over p's column in each lane above p, by walking
+	// left to the first column tall enough to reach the next lane and going up it, just like
+	// insert does for a tower. Searches go through the same nodes in the other direction, so
+	// this takes O(log n) expected time.
+	//
+	while (true)
+	{
+		while (p->up == nullptr && p->left != nullptr)	// We walk left until we find a column that goes up,
+		{
+			p = p->left;
+		}
+
+		if (p->up == nullptr)	// and if even the head doesn't go up, we are in the top lane.
+		{
+			return;
+		}
+
+		p = p->up;				// Otherwise, the node above skips over the column we started on.
+		p->width += change;
+	}
+}
+
+bool SkipList::remove(const char word[50])
+{
+	// To remove a word, we find its slow lane node and unlink its whole
+	// tower, regardless of how many times the word was inserted.
+	//
+	bool found;
+	size_t depth;
+
+	node* p = search(word, found, depth);
+
+	if (!found) // If the word isn't in the list,
+	{
+		return false; // there is nothing to remove.
+	}
+
+	removeTower(p);
+
+	return true;
+}
+
+bool SkipList::decrement(const char word[50])
+{
+	// To decrement a word, we find its slow lane node and lower its count by one. If
+	// the count would reach zero, the word is no longer in the set, so we remove it.
+	//
+	bool found;
+	size_t depth;
+
+	node* p = search(word, found, depth);
+
+	if (!found) // If the word isn't in the list,
+	{
+		return false; // there is nothing to decrement.
+	}
+
+	if (p->count > 1)	// If the word was inserted more than once,
+	{
+		p->count--;		// we just lower its count.
+	}
+	else
+	{
+		removeTower(p); // Otherwise, it is going away entirely.
+	}
+
+	return true;
+}
+
+void SkipList::removeTower(node* p)
+{
+	// This method removes the tower standing on slow lane node p. Every node in the
+	// tower is linked to its left and right neighbours in its lane, so we just link
+	// those neighbours to each other, working our way up the tower. If that leaves
+	// the top lanes empty, we take them out so that searches don't walk through them.
+	//
+	node* topLeft = nullptr; // The node to the left of the top of the tower
+
+	while (p != nullptr) // While there is still a node in the tower,
+	{
+		node* up = p->up;			// we remember the node above it,
+
+		p->left->width += p->width - 1;	// give the node on its left the steps it had, less the one to p itself,
+		topLeft = p->left;
+
+		p->left->right = p->right;	// link its left and right neighbours to each other,
+		p->right->left = p->left;
+		numberOfReferenceChanges += 2; // (that's two references changed)
+
+		if (up != nullptr)			// and disconnect the node above it.
+		{
+			up->down = nullptr;
+		}
+
+		releaseNode(p);				// The node is out of the list, so it goes onto the free list.
+
+		p = up;						// We then move up to the next node in the tower.
+	}
+
+	numberOfItems--;		// We've removed an item from the list,
+	numberOfDeletions++;	// so we count the deletion.
+
+	changeWidthsAbove(topLeft, -1); // In every lane above the tower, the node that skipped over it has one less step to take.
+
+	// If the top lane has nothing between its sentinels, it is of no use anymore, so we drop it.
+	// We always keep the slow lane, even when the list is empty.
+	while (height > 1 && head->right == tail)
+	{
+		node* oldHead = head;	// We remember the top sentinels,
+		node* oldTail = tail;
+
+		head = head->down;		// move our head and tail down a lane,
+		tail = tail->down;
+		head->up = nullptr;		// and disconnect them from the lane we are removing.
+		tail->up = nullptr;
+		numberOfReferenceChanges += 4;
+
+		releaseNode(oldHead);	// The old sentinels go onto the free list,
+		releaseNode(oldTail);
+
+		height--;				// and we are one lane shorter.
+		numberOfLanesRemoved++;
+	}
 }
 
 void SkipList::list()
@@ -311,7 +596,348 @@ void SkipList::larryList()
 	}
 }
 
-void SkipList::calculateNumWords(unsigned int& numWords, unsigned int& numUniqueWords)
+void SkipList::merge(const SkipList& other)
+{
+	// This method adds every word of the other skip list to this one, along with its count.
+	// Inserting them one at a time would search from the top of the list for every word.
+	// Since the other list's words come to us in alphabetical order, each one goes in after
+	// the one before it, so we never have to search at all: we keep a finger on our slow lane
+	// that only moves right, along with the last node we passed in every lane (predecessors),
+	// which is where a new tower's node in that lane has to go. A new word gets a tower of
+	// random height, just like an insert would give it, so the merged list looks like one
+	// built by inserts and stays balanced the way a skip list always is. Every node of both
+	// lists is passed once, so the merge takes O(n + m) expected time. If the other list is
+	// this list, the finger is always on the word we are merging, so every count doubles.
+	//
+	vector<node*> predecessors; // The last node in each lane, bottom lane first, that comes before the word we are merging
+
+	for (node* sentinel = head; sentinel != nullptr; sentinel = sentinel->down) // Every lane starts at its head sentinel.
+	{
+		predecessors.insert(predecessors.begin(), sentinel);
+	}
+
+	node* p = predecessors[0]; // Our finger on the slow lane
+
+	for (iterator theirs = other.lowerBound(nullptr, WordBound()); theirs != iterator(); ++theirs)
+	{
+		WordCount w = *theirs;
+		int compareValue = 1; // Whether the node after our finger is before, the same as, or after the word
+
+		while (!p->right->isSentinel && (compareValue = strcmp(p->right->word, w.word)) < 0) // We move the finger
+		{
+			numberOfKeyComparisonsMade++;
+			p = p->right; // up to the last word before the one we are merging,
+
+			int lane = 1;
+
+			for (node* q = p->up; q != nullptr; q = q->up) // and every node in its tower is now the last one we passed in its lane.
+			{
+				predecessors[lane++] = q;
+			}
+		}
+
+		if (!p->right->isSentinel)
+		{
+			numberOfKeyComparisonsMade++;
+		}
+
+		if (compareValue == 0) // If we have the word already, we just add their count to ours.
+		{
+			p->right->count += w.count;
+
+			continue;
+		}
+
+		node* newNode = allocateNode(); // Otherwise, the word goes right after the finger.
+
+		strcpy(newNode->word, w.word);
+		newNode->count = w.count;
+		newNode->left = p;
+		newNode->right = p->right;
+		p->right->left = newNode;
+		p->right = newNode;
+		numberOfReferenceChanges += 4;
+		numberOfItems++;
+
+		buildTower(newNode, randomLevel(), predecessors); // We give it a tower like an insert would,
+
+		p = newNode; // and since the next word comes after this one, the new tower is what we have passed.
+	}
+
+	// Keeping every width right while the towers go in would mean tracking where each predecessor is
+	// as well, so we leave them and work them all out once at the end, which is O(n + m) like the merge.
+	recalculateWidths();
+}
+
+void SkipList::recalculateWidths()
+{
+	// This method sets every width from the bottom up. The slow lane's widths are all one. In
+	// each lane above it, a node's width is the sum of the widths in the lane below from its own
+	// column up to the next column that reaches this lane, so we walk the lane below once,
+	// adding up widths and handing the sum over whenever we come to a column that goes up.
+	//
+	node* laneHead = head;
+
+	while (laneHead->down != nullptr) // We start with the slow lane.
+	{
+		laneHead = laneHead->down;
+	}
+
+	for (node* p = laneHead; p != nullptr; p = p->right)
+	{
+		p->width = 1;
+	}
+
+	while (laneHead->up != nullptr) // Each lane above is worked out from the one below it.
+	{
+		node* above = laneHead->up;	// The node in the lane above whose width we are adding up
+		unsigned int distance = 0;
+
+		for (node* p = laneHead; p->right != nullptr; )
+		{
+			distance += p->width;
+			p = p->right;
+
+			if (p->up != nullptr) // We've reached the next node of the lane above.
+			{
+				above->width = distance;
+				above = p->up;
+				distance = 0;
+			}
+		}
+
+		laneHead = laneHead->up;
+	}
+}
+
+void SkipList::buildTower(node* p, int level, vector<node*>& predecessors)
+{
+	// This method stacks the tower of a new slow lane node p. Each node of the tower goes
+	// right after that lane's predecessor. If the tower is taller than the list, we add a
+	// lane above the top for it, the same way insert does. Once the tower is built, each
+	// of its nodes is the new predecessor in its lane.
+	//
+	predecessors[0] = p;
+
+	for (int lane = 1; lane < level; lane++)
+	{
+		node* pileNode = allocateNode();
+
+		strcpy(pileNode->word, p->word);
+		pileNode->down = p;
+		p->up = pileNode;
+		numberOfReferenceChanges += 2;
+		numberOfHeadsCoinTosses++;
+
+		if (lane >= height) // If there isn't a lane this high yet, we add one above the top with new sentinels.
+		{
+			node* negativeNode = createSentinelNode();
+			node* positiveNode = createSentinelNode();
+
+			negativeNode->down = head;
+			head->up = negativeNode;
+			positiveNode->down = tail;
+			tail->up = positiveNode;
+			negativeNode->right = positiveNode;
+			positiveNode->left = negativeNode;
+			numberOfReferenceChanges += 6;
+
+			head = negativeNode;
+			tail = positiveNode;
+			height++;
+
+			predecessors.push_back(negativeNode); // The new lane is empty, so the pile node comes right after its head.
+		}
+
+		node* before = predecessors[lane]; // The pile node goes right after the last node we passed in its lane.
+
+		pileNode->left = before;
+		pileNode->right = before->right;
+		before->right->left = pileNode;
+		before->right = pileNode;
+		numberOfReferenceChanges += 4;
+
+		predecessors[lane] = pileNode;
+		p = pileNode;
+	}
+}
+
+SkipList::iterator SkipList::lowerBound(const char* lo, const WordBound& bound) const
+{
+	// This method finds the first word in the list that isn't less than lo. Just like
+	// search, we go as far right as we can in each lane while the words are less than lo,
+	// then drop down a lane. When we reach the slow lane, the node to our right is the
+	// answer. Queries don't count toward our insert statistics.
+	//
+	iterator it;		// The iterator we are building,
+	it.bound = bound;	// which stops at the given bound.
+
+	node* p = head; // We start at the head of the top lane.
+
+	while (true)
+	{
+		// While the node to our right has a word less than lo, we move right.
+		while (lo != nullptr && !p->right->isSentinel && strcmp(p->right->word, lo) < 0)
+		{
+			p = p->right;
+		}
+
+		if (p->down == nullptr) // If we are in the slow lane, we are done looking.
+		{
+			break;
+		}
+
+		p = p->down; // Otherwise, we go down a lane.
+	}
+
+	p = p->right; // The node to the right of where we stopped is the first word not less than lo.
+
+	it.current = (p->isSentinel || !bound.admits(p->word)) ? nullptr : p; // If there is no such word or it is past the bound, we start at the end.
+
+	return it;
+}
+
+WordRange<SkipList::iterator> SkipList::words() const
+{
+	// Every word in the list is the range starting at the smallest word with no bound.
+	return WordRange<iterator>(lowerBound(nullptr, WordBound()), iterator());
+}
+
+WordRange<SkipList::iterator> SkipList::rangeQuery(const char* lo, const char* hi) const
+{
+	// A range query starts at the first word not less than lo and stops after hi.
+	return WordRange<iterator>(lowerBound(lo, WordBound(WordBound::UPPER_BOUND, hi)), iterator());
+}
+
+WordRange<SkipList::iterator> SkipList::prefixQuery(const char* prefix) const
+{
+	// Every word that starts with the prefix is at least as big as the prefix itself,
+	// so we start there and stop at the first word that doesn't start with it.
+	return WordRange<iterator>(lowerBound(prefix, WordBound(WordBound::PREFIX, prefix)), iterator());
+}
+
+vector<WordCount> SkipList::topK(size_t k) const
+{
+	// We find the top k words with a single pass over every word in the list.
+	return selectTopK(words(), k);
+}
+
+size_t SkipList::nextPage(WordCursor& cursor, WordEntry* buffer, size_t capacity) const
+{
+	// The page starts at the first word that isn't less than the cursor's last word, which we
+	// find the same way a range query does, and fillPage skips that word if it is still here.
+	return fillPage(lowerBound(cursor.started ? cursor.last : nullptr, WordBound()), iterator(), cursor, buffer, capacity);
+}
+
+size_t SkipList::rank(const char word[50]) const
+{
+	// This method searches for the word the same way search does, adding up the width of every
+	// step to the right. Those are slow lane steps, so when we stop on the node before the word
+	// (or before where it would be), the sum is that node's place in the list, counting from one,
+	// which is the number of words before ours. Queries don't count toward our statistics.
+	//
+	node* p = head;
+	size_t before = 0; // The place of p in the list, where the head is zero
+
+	while (true)
+	{
+		while (!p->right->isSentinel && strcmp(p->right->word, word) < 0)
+		{
+			before += p->width;
+			p = p->right;
+		}
+
+		if (p->down == nullptr)
+		{
+			return before;
+		}
+
+		p = p->down;
+	}
+}
+
+WordCount SkipList::select(size_t index) const
+{
+	// This method goes right in each lane as long as that doesn't take us past the place we
+	// want (index + 1, since the head is at zero), and drops down a lane when it would. Once
+	// we can't go any further in the slow lane, we are either on the place we want, or the
+	// list doesn't go that far.
+	//
+	node* p = head;
+	size_t place = 0; // The place of p in the list, where the head is zero
+
+	while (true)
+	{
+		while (!p->right->isSentinel && place + p->width <= index + 1)
+		{
+			place += p->width;
+			p = p->right;
+		}
+
+		if (p->down == nullptr)
+		{
+			break;
+		}
+
+		p = p->down;
+	}
+
+	if (place != index + 1) // If we never got there, there is no word at that index.
+	{
+		return { nullptr, 0 };
+	}
+
+	return { p->word, p->count };
+}
+
+WordRange<SkipList::iterator> SkipList::page(size_t index, size_t count) const
+{
+	// A page is a range query from the word at its first index to the word at its last one.
+	// If the page starts past the last word (or is empty), it has nothing in it. If it runs
+	// past the last word, it just stops there.
+	//
+	WordCount first = select(index);
+
+	if (first.word == nullptr || count == 0)
+	{
+		return WordRange<iterator>(iterator(), iterator());
+	}
+
+	// The first word is there, so index is less than the number of words, and we can compare
+	// count to the words left from index on without index + count ever overflowing.
+	size_t size = (size_t)numberOfItems;
+	size_t lastIndex = count > size - index ? size - 1 : index + count - 1;
+	WordCount last = select(lastIndex);
+
+	return WordRange<iterator>(lowerBound(first.word, WordBound(WordBound::UPPER_BOUND, last.word)), iterator());
+}
+
+WordCount SkipList::iterator::operator*() const
+{
+	return { current->word, current->count };
+}
+
+SkipList::iterator& SkipList::iterator::operator++()
+{
+	// The next word is just the next node in the slow lane, unless that is the tail or past the bound.
+	node* p = current->right;
+
+	current = (p->isSentinel || !bound.admits(p->word)) ? nullptr : p;
+
+	return *this;
+}
+
+bool SkipList::iterator::operator==(const iterator& other) const
+{
+	return current == other.current;
+}
+
+bool SkipList::iterator::operator!=(const iterator& other) const
+{
+	return current != other.current;
+}
+
+void SkipList::calculateNumWords(unsigned long long& numWords, unsigned long long& numUniqueWords)
 {
 	// This method calculates the number of words and unique words in the list.
 	// The method takes two unsigned integer references that it initializes to zero.
@@ -367,6 +993,214 @@ unsigned int SkipList::getTotalNodes()
 	return totalNodes; // We've counted each node in each lane so we return the value.
 }
 
+bool SkipList::validate() const
+{
+	// This method walks every lane from top to bottom, checking that:
+	//
+	//  - each lane starts and ends with a sentinel, and the sentinels are stacked up and down,
+	//  - every left pointer points back at the node whose right pointer points at it,
+	//  - the words of each lane are in strictly increasing order,
+	//  - every node above the slow lane stands on a node with the same word, and every up
+	//    pointer and down pointer agree, so each tower is one straight stack of one word,
+	//  - the number of lanes is our height, only the slow lane can be empty, and the slow
+	//    lane has numberOfItems nodes, each with a count of at least one,
+	//  - every slow lane node has a width of one, and every node above it has the sum of the
+	//    widths it skips over in the lane below.
+	//
+	// Every node is visited once (twice counting the widths), and there is no recursion.
+	//
+	// Returns true if the width of a node in a lane above the slow lane matches the nodes below it, up to the next node.
+	auto widthMatches = [](const node* from, const node* to)
+	{
+		unsigned int distance = 0;
+
+		for (const node* q = from->down; q != nullptr && q != to->down; q = q->right)
+		{
+			distance += q->width;
+		}
+
+		return distance == from->width;
+	};
+
+	node* laneHead = head;	// The negative infinity sentinel of the lane we are on
+	node* laneTail = tail;	// The positive infinity sentinel of the lane we are on
+	node* headAbove = nullptr; // The negative infinity sentinel of the lane above, if there is one
+	node* tailAbove = nullptr;
+	int lanes = 0;
+	int items = 0;
+
+	while (laneHead != nullptr)
+	{
+		lanes++;
+
+		bool slowLane = laneHead->down == nullptr;
+
+		if (!laneHead->isSentinel || !laneTail->isSentinel || laneHead->left != nullptr || laneTail->right != nullptr ||
+			laneHead->up != headAbove || laneTail->up != tailAbove || (slowLane != (laneTail->down == nullptr)))
+		{
+			cout << "Skip List is invalid: the sentinels of lane " << lanes << " (from the top) aren't linked properly\n";
+
+			return false;
+		}
+
+		node* previous = laneHead;
+		node* p = laneHead->right;
+		int laneNodes = 0;
+
+		while (true)
+		{
+			if (p == nullptr || p->left != previous)
+			{
+				cout << "Skip List is invalid: lane " << lanes << " (from the top) has a broken left or right pointer\n";
+
+				return false;
+			}
+
+			if (p->isSentinel) // The only sentinel we can run into is the end of the lane.
+			{
+				if (p != laneTail)
+				{
+					cout << "Skip List is invalid: lane " << lanes << " (from the top) runs into another lane's sentinel\n";
+
+					return false;
+				}
+
+				if (slowLane ? previous->width != 1 : !widthMatches(previous, p))
+				{
+					cout << "Skip List is invalid: the last node of lane " << lanes << " (from the top) has the wrong width\n";
+
+					return false;
+				}
+
+				break;
+			}
+
+			if (previous != laneHead && strcmp(previous->word, p->word) >= 0)
+			{
+				cout << "Skip List is invalid: \"" << p->word << "\" comes after \"" << previous->word << "\" in lane " << lanes << " (from the top)\n";
+
+				return false;
+			}
+
+			if (slowLane ? p->down != nullptr : (p->down == nullptr || p->down->up != p || strcmp(p->down->word, p->word) != 0))
+			{
+				cout << "Skip List is invalid: the tower of \"" << p->word << "\" is broken below lane " << lanes << " (from the top)\n";
+
+				return false;
+			}
+
+			if (slowLane ? previous->width != 1 : !widthMatches(previous, p))
+			{
+				cout << "Skip List is invalid: the node before \"" << p->word << "\" in lane " << lanes << " (from the top) has the wrong width\n";
+
+				return false;
+			}
+
+			if (p->up != nullptr && p->up->down != p)
+			{
+				cout << "Skip List is invalid: the tower of \"" << p->word << "\" is broken above lane " << lanes << " (from the top)\n";
+
+				return false;
+			}
+
+			if (slowLane && p->count == 0)
+			{
+				cout << "Skip List is invalid: \"" << p->word << "\" has a count of zero\n";
+
+				return false;
+			}
+
+			laneNodes++;
+			previous = p;
+			p = p->right;
+		}
+
+		if (laneNodes == 0 && !slowLane) // Empty lanes above the slow lane are always dropped.
+		{
+			cout << "Skip List is invalid: lane " << lanes << " (from the top) is empty\n";
+
+			return false;
+		}
+
+		if (slowLane)
+		{
+			items = laneNodes;
+		}
+
+		headAbove = laneHead;
+		tailAbove = laneTail;
+		laneHead = laneHead->down;
+		laneTail = laneTail->down;
+	}
+
+	if (lanes != height || items != numberOfItems)
+	{
+		cout << "Skip List is invalid: it has " << lanes << " lanes and " << items << " words, but thinks it has "
+			<< height << " and " << numberOfItems << "\n";
+
+		return false;
+	}
+
+	return true;
+}
+
+unsigned long long SkipList::getKeyComparisons()
+{
+	return numberOfKeyComparisonsMade;
+}
+
+unsigned long long SkipList::getReferenceChanges()
+{
+	return numberOfReferenceChanges;
+}
+
+unsigned int SkipList::getHeight()
+{
+	return height;
+}
+
+unsigned long long SkipList::getMemoryUsage()
+{
+	// This method returns the number of bytes the nodes of the skip list take up. That is
+	// every node in every lane, plus the two sentinel nodes at the ends of each lane.
+	//
+	return ((unsigned long long)getTotalNodes() + 2 * height) * sizeof(node);
+}
+
+unsigned long long SkipList::getAllocatedBytes()
+{
+	// This method adds up how big the allocator says each node's block really is, which
+	// includes whatever the allocator rounded the node's size up by. We walk every lane
+	// from its head sentinel to its tail sentinel, counting both sentinels.
+	//
+	unsigned long long bytes = 0;
+
+	for (node* p = head; p != nullptr; p = p->down) // For each lane, from the top down,
+	{
+		for (node* q = p; q != nullptr; q = q->right) // we count every node in it.
+		{
+			bytes += MemoryUsage::allocatedSize(q);
+		}
+	}
+
+	return bytes + getFreeListBytes(); // The removed nodes on the free list are still ours too.
+}
+
+unsigned long long SkipList::getFreeListBytes()
+{
+	// This method adds up the blocks of the removed nodes waiting on the free list. They
+	// aren't part of the skip list anymore, but the allocator hasn't gotten them back either.
+	//
+	unsigned long long bytes = 0;
+
+	for (node* p = freeList; p != nullptr; p = p->right)
+	{
+		bytes += MemoryUsage::allocatedSize(p);
+	}
+
+	return bytes;
+}
+
 void SkipList::displayStatistics()
 {
 	// This method displays statistics related to the number of words in the list and
@@ -376,11 +1210,15 @@ void SkipList::displayStatistics()
 
 	cout << "Skip List Stats:\n"; // Print out a header specifying that these are skip list stats
 
-	unsigned int numWords, numUniqueWords; // Declare variables for the total number of words and unique words in the list
+	unsigned long long numWords, numUniqueWords; // Declare variables for the total number of words and unique words in the list
 
 	// Call the calculateNumWords, passing in our word counts by reference so that they are set to the proper values
 	calculateNumWords(numWords, numUniqueWords);
 
+	unsigned long long liveBytes = getMemoryUsage(); // We also find out how much memory the nodes take up,
+	unsigned long long allocatedBytes = getAllocatedBytes(); // and how much the allocator really set aside for them.
+	unsigned long long freeListBytes = getFreeListBytes(); // Some of that may be removed nodes waiting on the free list.
+
 	cout << "Distinct Words / Slow Lane Nodes: " << numUniqueWords << "\n"; // Print out the total number of unique words / slow lane nodes
 	cout << "Total Words: " << numWords << "\n"; // Print out the total number of words
 	cout << "Height: " << height << "\n"; // Print out the height of the skip list
@@ -389,4 +1227,19 @@ void SkipList::displayStatistics()
 	cout << "Heads Coin Tosses / Fast Lane Nodes: " << numberOfHeadsCoinTosses << "\n"; // Print out the number of coin tosses that resulted in heads
 	cout << "Number of Items: " << numberOfItems << "\n"; // Print out the number of items in the skip list
 	cout << "Total Nodes: " << getTotalNodes() << "\n"; // Print out the total number of nodes in the list (meaning every node in every lane)
+	cout << "Node Size: " << sizeof(node) << " bytes\n"; // Print out how big a single node is
+	cout << "Live Bytes: " << liveBytes << "\n"; // Print out the number of bytes the nodes take up
+	cout << "Allocated Bytes: " << allocatedBytes << "\n"; // Print out the number of bytes the allocator set aside for them
+	cout << "Free List Bytes: " << freeListBytes << "\n"; // Print out how much of that is removed nodes waiting to be reused
+	cout << "Allocator Overhead: " << (allocatedBytes > liveBytes + freeListBytes ? allocatedBytes - liveBytes - freeListBytes : 0) << " bytes\n"; // Print out how much of the rest is rounding
+	cout << "Bytes per Distinct Word: " << (numUniqueWords > 0 ? (double)allocatedBytes / numUniqueWords : 0) << "\n"; // Print out what each distinct word costs
+	cout << "Promotion Probability: " << 1.0 / (1ULL << promotionBits) << "\n"; // Print out the probability that a node is promoted to the next lane
+	cout << "Max Level: " << maxLevel << "\n"; // Print out the tallest a tower can be
+	cout << "Seed: " << seed << "\n"; // Print out the seed so that this exact list can be built again
+	cout << "Deletions: " << numberOfDeletions << "\n"; // Print out the number of towers removed from the list
+	cout << "Lanes Removed: " << numberOfLanesRemoved << "\n"; // Print out the number of empty top lanes that were dropped after deletions
+	insertDepths.display("Insert Depths"); // Print out how many nodes each insert looked at
+
+	// Print out how many nodes a search for each of the ten most frequent words looks at.
+	displayWordDepths("Top Word Depths", topK(10), [this](const char* word) { return depthOf(word); });
 }
\ No newline at end of file
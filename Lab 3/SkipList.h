@@ -14,19 +14,47 @@
 
 #include <time.h>
 #include <random>
+#include <cmath>
 #include <iostream>
+#include "Statistics.h"
+#include "MemoryUsage.h"
+#include "Bits.h"
+#include "WordQuery.h"
+#include "DepthHistogram.h"
 
 using namespace std;
 
 class SkipList
 {
 public:
-	SkipList();
+	SkipList(); // Constructs a skip list whose level generator is seeded with the current time
+
+	// Constructs a skip list whose level generator is seeded with the given seed, so that the same
+	// input always builds the same list. A new node is promoted to each next lane with the given
+	// probability, which is rounded to the nearest power of one half, and no tower is taller than maxLevel.
+	SkipList(unsigned long long seed, double promotionProbability = 0.5, int maxLevel = 32);
 	~SkipList();
 
 	void insert(const char word[50]); // adds a word to the skip list
+	bool remove(const char word[50]); // removes a word from the skip list no matter its count, returning false if it wasn't there
+	bool decrement(const char word[50]); // lowers a word's count by one, removing it at zero, returning false if it wasn't there
 	void list(); // Prints a list of all words in the skip list.
 	void displayStatistics(); // Displays statistics about the skip list operations performed.
+
+	// Adds every word of the other skip list to this one, along with its count, in O(n + m) expected
+	// time. The other skip list isn't changed.
+	void merge(const SkipList& other);
+
+	// Checks every invariant of the skip list in O(n) time without recursion, printing the first one that
+	// is broken. Returns true if it is valid.
+	bool validate() const;
+
+	unsigned long long getKeyComparisons(); // Returns the number of key comparisons made so far
+	unsigned long long getReferenceChanges(); // Returns the number of reference changes made so far
+	unsigned int getHeight(); // Returns the number of lanes in the skip list
+	unsigned long long getMemoryUsage(); // Returns the number of bytes taken up by the nodes of the skip list
+	unsigned long long getAllocatedBytes(); // Returns the number of bytes the allocator set aside for the nodes of the skip list, including removed ones waiting to be reused
+	unsigned long long getFreeListBytes(); // Returns the number of those bytes that belong to removed nodes on the free list
 	void larryList(); // Displays the skip list sideways so that all of the nodes and lanes can be seen
 private:
 	struct node
@@ -40,23 +68,97 @@ private:
 		node* right = nullptr;
 
 		bool isSentinel = false;
+		unsigned int width = 1; // The number of slow lane steps from this node to the one on its right (always one in the slow lane)
+	};
+
+public:
+	// An iterator that walks through the words of the slow lane in alphabetical order.
+	class iterator
+	{
+	public:
+		WordCount operator*() const;					// Returns the word and count of the node the iterator is on
+		iterator& operator++();							// Moves the iterator on to the next word in alphabetical order
+		bool operator==(const iterator& other) const;	// Two iterators are equal if they are on the same node
+		bool operator!=(const iterator& other) const;
+	private:
+		friend class SkipList;
+
+		node* current = nullptr;	// The slow lane node the iterator is on, or nullptr if it is at the end
+		WordBound bound;			// Where the iteration stops
 	};
 
+	WordRange<iterator> words() const; // Returns every word in the list, in alphabetical order
+	WordRange<iterator> rangeQuery(const char* lo, const char* hi) const; // Returns the words from lo to hi, including lo and hi
+	WordRange<iterator> prefixQuery(const char* prefix) const; // Returns the words that start with the given prefix
+	vector<WordCount> topK(size_t k) const; // Returns the k most frequent words in the list, most frequent first
+
+	// Returns the number of words in the list that come before the given word alphabetically, which is
+	// the word's index (counting from 0) if it is in the list. This takes O(log n) expected time.
+	size_t rank(const char word[50]) const;
+
+	// Returns the word at the given index (counting from 0) in alphabetical order, or a null word with a
+	// count of zero if the list doesn't have that many words. This takes O(log n) expected time.
+	WordCount select(size_t index) const;
+
+	// Returns the count words starting at the given index in alphabetical order, so that a listing can
+	// be paged through without walking from the first word every time.
+	WordRange<iterator> page(size_t index, size_t count) const;
+
+	// Copies the next page of up to capacity words (and their counts), in alphabetical order, into the
+	// buffer, starting after the cursor's last word, and moves the cursor along. Finding where the page
+	// starts takes O(log n) expected time, however far into the listing the cursor is. Returns the number of
+	// words copied, which is zero once the cursor has gone past the last word.
+	size_t nextPage(WordCursor& cursor, WordEntry* buffer, size_t capacity) const;
+private:
+	// Returns an iterator on the first word that isn't less than lo (or the first word if lo is nullptr) which stops at the given bound
+	iterator lowerBound(const char* lo, const WordBound& bound) const;
+
 	node* createSentinelNode();
 
-	node* search(const char word[50], bool& found);
+	node* allocateNode(); // Returns a fresh node, reusing one from the free list if we have one
+	void releaseNode(node* p); // Puts a node that was removed from the list onto the free list
+
+	void removeTower(node* p); // Unlinks the tower standing on the given slow lane node and drops any top lanes left empty
+
+	// Adds change to the width of the node that skips over p's column in every lane above p
+	void changeWidthsAbove(node* p, int change);
+
+	// Searches for the slow lane node with the given word, or the one just before where it would be.
+	// depth is set to the number of nodes the word was compared against on the way.
+	node* search(const char word[50], bool& found, size_t& depth);
 
-	void calculateNumWords(unsigned int& numWords, unsigned int& numUniqueWords);
+	// Returns the number of nodes a search for the word compares it against, or zero if it isn't in
+	// the list. This doesn't count toward any statistics.
+	size_t depthOf(const char* word) const;
+
+	int randomLevel(); // Returns the height of the tower for a new node, drawn from a single random word
+
+	// Stacks a new tower of the given height on top of the slow lane node p, linking each of its nodes
+	// in after the node of the same lane in predecessors (bottom lane first), adding lanes as needed.
+	void buildTower(node* p, int level, vector<node*>& predecessors);
+
+	void recalculateWidths(); // Works out the width of every node again from the slow lane up, in O(n) time
+
+	void calculateNumWords(unsigned long long& numWords, unsigned long long& numUniqueWords);
 	unsigned int getTotalNodes();
 
-	mt19937 coin;
+	mt19937_64 levelGenerator;	// The random number generator that decides the height of each new tower
+	unsigned long long seed;	// The seed the level generator started with
+	int promotionBits;			// The number of zero bits a random word needs per level, so a promotion has probability 2^-promotionBits
+	int maxLevel;				// The tallest a tower is allowed to be
 
 	node* head;
 	node* tail;
 
+	node* freeList = nullptr; // A list of removed nodes, linked through their right pointers, that we reuse before allocating new ones
+
 	int height;
 	int numberOfItems;
-	unsigned long long numberOfKeyComparisonsMade = 0;
-	unsigned long long numberOfReferenceChanges = 0;
-	unsigned long long numberOfHeadsCoinTosses = 0;
+	DepthHistogram insertDepths; // How many nodes each insert compared its word against, whether it found the word or added it
+
+	statistic numberOfKeyComparisonsMade = 0;
+	statistic numberOfReferenceChanges = 0;
+	statistic numberOfHeadsCoinTosses = 0;
+	statistic numberOfDeletions = 0;
+	statistic numberOfLanesRemoved = 0;
 };
\ No newline at end of file
@@ -0,0 +1,477 @@
+//==============================================================================================
+// File: SplayTree.cpp - Splay tree implementation
+// c.f.: SplayTree.h
+//
+// A splay tree (Sleator and Tarjan, 1985) is a binary search tree that moves every word it
+// touches up to the root. It doesn't keep any balance information, and a single access can be
+// as slow as in our BST, but any sequence of accesses costs O(log n) each on average. What makes
+// it interesting for word counting is that it adapts to the input: a word that comes up again
+// and again stays near the root, so common words like "the" are found after a comparison or two
+// while the AVL tree and RBT look for them at the same depth as any other word.
+//
+// We splay top-down: on the way down from the root, every node we pass goes into a left tree
+// (the nodes smaller than our word) or a right tree (the nodes bigger than it), rotating first
+// whenever we go the same direction twice in a row, which is what halves the depth of the path.
+// When we get to the word (or the end of the path), we hang the left and right trees off of it
+// and it becomes the root. This needs no parent pointers and no stack.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "SplayTree.h"
+
+SplayTree::SplayTree()
+{
+	// constructor -- there's nothing to do other then making sure the root pointer is a nullptr.
+	//
+	root = nullptr;
+}
+
+SplayTree::~SplayTree()
+{
+	// On deconstruction, we delete every node. A splay tree built from sorted input is as deep as
+	// it has nodes, so we keep the nodes we still have to delete on a stack of our own, like the BST does.
+	//
+	vector<node*> stack;
+
+	if (root != nullptr)
+	{
+		stack.push_back(root);
+	}
+
+	while (!stack.empty())
+	{
+		node* p = stack.back();
+		stack.pop_back();
+
+		if (p->leftChild != nullptr)
+		{
+			stack.push_back(p->leftChild);
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(p->rightChild);
+		}
+
+		delete p;
+	}
+
+	root = nullptr;
+}
+
+void SplayTree::splay(const char word[50])
+{
+	// This is the top-down splay. header stands in for the roots of the left and right trees while
+	// we build them: header.rightChild ends up as the root of the left tree, and header.leftChild as
+	// the root of the right tree. leftMax is the biggest node of the left tree, which is where the
+	// next node we add to it goes, and rightMin is the smallest node of the right tree.
+	//
+	node header;
+	node* leftMax = &header;
+	node* rightMin = &header;
+	node* t = root;
+	size_t depth = 1; // The depth t was at before we started changing the tree, which is the number of nodes we have compared against
+
+	numberOfSplays++;
+
+	while (true)
+	{
+		numberOfKeyComparisonsMade++;
+
+		int compareValue = strcmp(word, t->word);
+
+		if (compareValue < 0) // If our word is in t's left subtree,
+		{
+			if (t->leftChild == nullptr) // and there is no left subtree, t is as close as we get.
+			{
+				break;
+			}
+
+			numberOfKeyComparisonsMade++;
+
+			if (strcmp(word, t->leftChild->word) < 0) // If we are going left twice (zig-zig), we rotate right first.
+			{
+				node* y = t->leftChild;
+
+				t->leftChild = y->rightChild;
+				y->rightChild = t;
+				t = y;
+
+				depth++;
+				numberOfRotations++;
+				numberOfReferenceChanges += 2;
+
+				if (t->leftChild == nullptr)
+				{
+					break;
+				}
+			}
+
+			rightMin->leftChild = t; // t and everything right of it is bigger than our word, so it goes in the right tree.
+			rightMin = t;
+			t = t->leftChild;
+
+			depth++;
+			numberOfLinks++;
+			numberOfReferenceChanges++;
+		}
+		else if (compareValue > 0) // If our word is in t's right subtree, we do the mirror image of the above.
+		{
+			if (t->rightChild == nullptr)
+			{
+				break;
+			}
+
+			numberOfKeyComparisonsMade++;
+
+			if (strcmp(word, t->rightChild->word) > 0) // If we are going right twice (zag-zag), we rotate left first.
+			{
+				node* y = t->rightChild;
+
+				t->rightChild = y->leftChild;
+				y->leftChild = t;
+				t = y;
+
+				depth++;
+				numberOfRotations++;
+				numberOfReferenceChanges += 2;
+
+				if (t->rightChild == nullptr)
+				{
+					break;
+				}
+			}
+
+			leftMax->rightChild = t; // t and everything left of it is smaller than our word, so it goes in the left tree.
+			leftMax = t;
+			t = t->rightChild;
+
+			depth++;
+			numberOfLinks++;
+			numberOfReferenceChanges++;
+		}
+		else // Otherwise, t is our word.
+		{
+			break;
+		}
+	}
+
+	insertDepths.record(depth);
+
+	// We put the tree back together: t's subtrees go at the open ends of the left and right trees,
+	// and the left and right trees become t's subtrees.
+	leftMax->rightChild = t->leftChild;
+	rightMin->leftChild = t->rightChild;
+	t->leftChild = header.rightChild;
+	t->rightChild = header.leftChild;
+	root = t;
+
+	numberOfReferenceChanges += 5;
+}
+
+void SplayTree::insert(const char word[50])
+{
+	// To add a word, we splay the tree around it. If the root is then our word, we count it.
+	// Otherwise, the root is the word that would be next to ours, so our new node becomes the
+	// root, with the old root on one side and the old root's subtree on our side on the other.
+	//
+	if (root == nullptr) // If the tree is empty, our word's node is the whole tree.
+	{
+		root = new node();
+		strcpy(root->word, word);
+
+		insertDepths.record(0);
+		numberOfReferenceChanges++;
+
+		return;
+	}
+
+	splay(word);
+
+	numberOfKeyComparisonsMade++;
+
+	int compareValue = strcmp(word, root->word);
+
+	if (compareValue == 0) // If the word was already in the tree, it is now at the root.
+	{
+		root->count++;
+
+		return;
+	}
+
+	node* p = new node();
+
+	strcpy(p->word, word);
+
+	if (compareValue < 0) // If our word is smaller than the root, the root and its right subtree go on our right,
+	{
+		p->leftChild = root->leftChild; // and its left subtree (all smaller than us) goes on our left.
+		p->rightChild = root;
+		root->leftChild = nullptr;
+	}
+	else // Otherwise, it's the mirror image.
+	{
+		p->rightChild = root->rightChild;
+		p->leftChild = root;
+		root->rightChild = nullptr;
+	}
+
+	root = p;
+
+	numberOfReferenceChanges += 4;
+}
+
+void SplayTree::list()
+{
+	// This method prints out the nodes in a nicely formatted list with indexes and the node's word
+	// and count. We do the in-order traversal with a stack of our own, since the tree can be deep.
+	//
+	if (root == nullptr) // If the root is nullptr, than there is nothing in the tree,
+	{
+		cout << "Set is empty" << endl; // so we just print out "Set is empty"
+
+		return;
+	}
+
+	cout << "Set contains: ";
+
+	vector<node*> stack; // The nodes we have gone left of but not printed yet
+	node* p = root;
+	int index = 0;
+
+	while (p != nullptr || !stack.empty())
+	{
+		while (p != nullptr) // We go as far left as we can, remembering the nodes we pass,
+		{
+			stack.push_back(p);
+			p = p->leftChild;
+		}
+
+		p = stack.back(); // then print the last one we passed,
+		stack.pop_back();
+
+		if (index != 0)
+		{
+			cout << ", ";
+		}
+
+		cout << "(" << ++index << ") " << p->word << " " << p->count;
+
+		p = p->rightChild; // and move on to its right subtree.
+	}
+
+	cout << endl;
+}
+
+void SplayTree::calculateNumWords(unsigned long long& numWords, unsigned long long& numUniqueWords)
+{
+	// This method visits every node with a stack of our own, counting its word and its count.
+	//
+	vector<node*> stack;
+
+	numWords = 0;
+	numUniqueWords = 0;
+
+	if (root != nullptr)
+	{
+		stack.push_back(root);
+	}
+
+	while (!stack.empty())
+	{
+		node* p = stack.back();
+		stack.pop_back();
+
+		numWords += p->count;
+		numUniqueWords++;
+
+		if (p->leftChild != nullptr)
+		{
+			stack.push_back(p->leftChild);
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(p->rightChild);
+		}
+	}
+}
+
+unsigned int SplayTree::depthOf(const char* word) const
+{
+	// This method walks down the tree like a binary search tree lookup, only keeping track of how deep it is.
+	//
+	node* p = root;
+	unsigned int depth = 1;
+
+	while (p != nullptr)
+	{
+		int compareValue = strcmp(word, p->word);
+
+		if (compareValue == 0)
+		{
+			return depth;
+		}
+
+		p = compareValue < 0 ? p->leftChild : p->rightChild;
+		depth++;
+	}
+
+	return 0;
+}
+
+vector<WordCount> SplayTree::topK(size_t k) const
+{
+	// We gather every node's word and count with a stack of our own and keep the k most frequent.
+	//
+	vector<WordCount> allWords;
+	vector<node*> stack;
+
+	if (root != nullptr)
+	{
+		stack.push_back(root);
+	}
+
+	while (!stack.empty())
+	{
+		node* p = stack.back();
+		stack.pop_back();
+
+		allWords.push_back({ p->word, p->count });
+
+		if (p->leftChild != nullptr)
+		{
+			stack.push_back(p->leftChild);
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(p->rightChild);
+		}
+	}
+
+	return selectTopK(allWords, k);
+}
+
+unsigned int SplayTree::getHeight()
+{
+	// This method finds the deepest node by visiting every node along with its depth.
+	//
+	vector<pair<node*, unsigned int>> stack;
+	unsigned int height = 0;
+
+	if (root != nullptr)
+	{
+		stack.push_back(make_pair(root, 1u));
+	}
+
+	while (!stack.empty())
+	{
+		node* p = stack.back().first;
+		unsigned int depth = stack.back().second;
+		stack.pop_back();
+
+		height = depth > height ? depth : height;
+
+		if (p->leftChild != nullptr)
+		{
+			stack.push_back(make_pair(p->leftChild, depth + 1));
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(make_pair(p->rightChild, depth + 1));
+		}
+	}
+
+	return height;
+}
+
+unsigned long long SplayTree::getKeyComparisons()
+{
+	return numberOfKeyComparisonsMade;
+}
+
+unsigned long long SplayTree::getReferenceChanges()
+{
+	return numberOfReferenceChanges;
+}
+
+unsigned long long SplayTree::getMemoryUsage()
+{
+	unsigned long long numWords, numUniqueWords;
+
+	calculateNumWords(numWords, numUniqueWords);
+
+	return numUniqueWords * sizeof(node);
+}
+
+unsigned long long SplayTree::getAllocatedBytes()
+{
+	// This method adds up how big the allocator says each node's block really is.
+	//
+	unsigned long long bytes = 0;
+	vector<node*> stack;
+
+	if (root != nullptr)
+	{
+		stack.push_back(root);
+	}
+
+	while (!stack.empty())
+	{
+		node* p = stack.back();
+		stack.pop_back();
+
+		bytes += MemoryUsage::allocatedSize(p);
+
+		if (p->leftChild != nullptr)
+		{
+			stack.push_back(p->leftChild);
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(p->rightChild);
+		}
+	}
+
+	return bytes;
+}
+
+void SplayTree::displayStatistics()
+{
+	// This method displays statistics related to the number of words in the tree and the
+	// splaying done as words are inserted.
+	//
+	unsigned long long numWords, numUniqueWords;
+
+	calculateNumWords(numWords, numUniqueWords);
+
+	unsigned long long liveBytes = getMemoryUsage(); // We also find out how much memory the nodes take up,
+	unsigned long long allocatedBytes = getAllocatedBytes(); // and how much the allocator really set aside for them.
+
+	cout << "Splay Tree Stats:\n"; // Print out a header specifying that these are splay tree stats
+	cout << "Distinct Words: " << numUniqueWords << "\n"; // Print out the total number of unique words
+	cout << "Total Words: " << numWords << "\n"; // Print out the total number of words
+	cout << "Height: " << getHeight() << "\n"; // Print out the height of the tree
+	cout << "Node Size: " << sizeof(node) << " bytes\n"; // Print out how big a single node is
+	cout << "Live Bytes: " << liveBytes << "\n"; // Print out the number of bytes the nodes take up
+	cout << "Allocated Bytes: " << allocatedBytes << "\n"; // Print out the number of bytes the allocator set aside for them
+	cout << "Allocator Overhead: " << (allocatedBytes > liveBytes ? allocatedBytes - liveBytes : 0) << " bytes\n"; // Print out how much of that is rounding
+	cout << "Bytes per Distinct Word: " << (numUniqueWords > 0 ? (double)allocatedBytes / numUniqueWords : 0) << "\n"; // Print out what each distinct word costs
+	cout << "Reference Changes: " << numberOfReferenceChanges << "\n"; // Print out the total number of reference changes made
+	cout << "Key Comparisons: " << numberOfKeyComparisonsMade << "\n"; // Print out the total number of key comparisons made
+	cout << "Key Comparisons per Word: " << (numWords > 0 ? (double)numberOfKeyComparisonsMade / numWords : 0) << "\n"; // Print out how many comparisons each word took
+	cout << "Splays: " << numberOfSplays << "\n"; // Print out the number of splays
+	cout << "Splay Rotations: " << numberOfRotations << "\n"; // Print out the number of rotations made while splaying
+	cout << "Splay Links: " << numberOfLinks << "\n"; // Print out the number of nodes moved into the left and right trees
+	insertDepths.display("Insert Depths"); // Print out how many nodes each insert looked at before splaying
+
+	// Print out where the ten most frequent words are, which is where most of the inserts went.
+	displayWordDepths("Top Word Depths", topK(10), [this](const char* word) { return depthOf(word); });
+}
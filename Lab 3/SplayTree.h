@@ -0,0 +1,68 @@
+//==============================================================================================
+// File: SplayTree.h - Splay tree
+// Header for SplayTree.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include "Statistics.h"
+#include "MemoryUsage.h"
+#include "DepthHistogram.h"
+
+using namespace std;
+
+class SplayTree
+{
+public:
+	SplayTree();
+	~SplayTree();
+
+	void insert(const char word[50]); // adds a word to the tree
+	void list(); // Prints a list of all words in the tree.
+	void displayStatistics(); // Displays statistics about the tree operations performed.
+
+	unsigned long long getKeyComparisons(); // Returns the number of key comparisons made so far
+	unsigned long long getReferenceChanges(); // Returns the number of reference changes made so far
+	unsigned int getHeight(); // Returns the height of the tree
+	unsigned long long getMemoryUsage(); // Returns the number of bytes taken up by the nodes of the tree
+	unsigned long long getAllocatedBytes(); // Returns the number of bytes the allocator set aside for the nodes of the tree
+	vector<WordCount> topK(size_t k) const; // Returns the k most frequent words in the tree, most frequent first
+private:
+	struct node
+	{
+		char word[50] = {};			// The word of the node
+		unsigned int count = 1;		// The amount of times the word has been inserted into the splay tree
+		node* leftChild = nullptr;	// A pointer to the left child of the node
+		node* rightChild = nullptr;	// A pointer to the right child of the node
+	};
+
+	// Splays the tree around the given word: afterwards, the root is the word's node if it is in
+	// the tree, and otherwise the last node we looked at on the way to where it would go.
+	void splay(const char word[50]);
+
+	// Returns the depth of the word's node, counting the root as 1, or zero if it isn't in the tree. This doesn't count toward any statistics.
+	unsigned int depthOf(const char* word) const;
+
+	// Calculates the number of words and unique words in the splay tree.
+	void calculateNumWords(unsigned long long& numWords, unsigned long long& numUniqueWords);
+
+	node* root = nullptr; // A pointer to the root of the splay tree. If this is nullptr, no nodes exist in the tree.
+
+	DepthHistogram insertDepths; // How many nodes each insert compared its word against before its word was splayed to the root
+
+	statistic numberOfReferenceChanges = 0;		// Keeps track of the number of times the root pointer or child pointers change.
+	statistic numberOfKeyComparisonsMade = 0;	// Keeps track of the number of word key comparisons during tree inserts.
+	statistic numberOfRotations = 0;			// Keeps track of the number of rotations done while splaying (the first half of each zig-zig).
+	statistic numberOfLinks = 0;				// Keeps track of the number of nodes moved into the left or right tree while splaying.
+	statistic numberOfSplays = 0;				// Keeps track of the number of splays performed.
+};
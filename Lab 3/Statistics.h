@@ -0,0 +1,63 @@
+//==============================================================================================
+// File: Statistics.h - Statistics counter policy
+//
+// Every datatype in this program counts the work it does (key comparisons, reference changes,
+// rotations, and so on) so that we can compare them. Those counters are incremented in the
+// tightest loops of every insert, which costs stores and keeps the compiler from optimizing
+// those loops as well as it could. To measure real throughput, the counters can be compiled
+// out by building with COLLECT_STATISTICS defined to 0. Each counter is declared with the
+// "statistic" type below, which is StatisticCounter<true> (a real counter) in an instrumented
+// build and StatisticCounter<false> (an empty type whose operations do nothing) otherwise,
+// so none of the code that increments the counters has to change between the two builds.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#ifndef COLLECT_STATISTICS
+#define COLLECT_STATISTICS 1 // Statistics are collected unless the build says otherwise.
+#endif
+
+template <bool Enabled>
+class StatisticCounter;
+
+template <>
+class StatisticCounter<true>
+{
+public:
+	StatisticCounter(unsigned long long initialValue = 0) : value(initialValue) {}
+
+	StatisticCounter& operator++() { value++; return *this; }				// ++counter
+	StatisticCounter& operator++(int) { value++; return *this; }			// counter++ (we never use the old value)
+	StatisticCounter& operator+=(unsigned long long amount) { value += amount; return *this; }
+
+	operator unsigned long long() const { return value; } // Lets a counter be printed or used like a number
+private:
+	unsigned long long value;
+};
+
+template <>
+class StatisticCounter<false>
+{
+public:
+	StatisticCounter(unsigned long long = 0) {}
+
+	StatisticCounter& operator++() { return *this; }		// Every operation is empty,
+	StatisticCounter& operator++(int) { return *this; }		// so the compiler removes the
+	StatisticCounter& operator+=(unsigned long long) { return *this; } // increments entirely.
+
+	operator unsigned long long() const { return 0; } // A compiled out counter always reads as zero.
+};
+
+// The counter type used by every datatype.
+typedef StatisticCounter<COLLECT_STATISTICS != 0> statistic;
+
+// Returns true if this build collects statistics, so the driver can tell the user when the counters read zero.
+inline bool statisticsEnabled()
+{
+	return COLLECT_STATISTICS != 0;
+}
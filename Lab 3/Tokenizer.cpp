@@ -0,0 +1,370 @@
+//==============================================================================================
+// File: Tokenizer.cpp - Input file tokenizer implementation
+// c.f.: Tokenizer.h
+//
+// This class started as the file parser code given by Dr. Thomas in listing 2 of the lab PDF,
+// pulled out of the driver so that every benchmark reads words the same way. A word is a run
+// of characters between delimiters (spaces, line breaks, tabs and common punctuation).
+//
+// Listing 2 reads a byte at a time and compares each byte to every delimiter, and it treats
+// the bytes of a UTF-8 character as separate characters, so punctuation like curly quotes and
+// dashes ends up glued onto words. Instead, we read the file in large blocks and look up the
+// class of each byte in a table, so the common ASCII case is one lookup per byte. Only bytes
+// above 127 are decoded as UTF-8, and if the character they make up is Unicode punctuation
+// or a space, it separates words like the ASCII delimiters do. Bytes that aren't valid UTF-8
+// (like a Windows-1252 file's curly quotes) are kept in the word as they are, which is what
+// listing 2 always did. When asked to, we also fold each word to lowercase, which covers
+// ASCII, Latin-1, Latin Extended-A, Greek and Cyrillic letters.
+//
+// Listing 2 assumes no word is longer than 49 characters and writes past the end of its
+// buffer otherwise, so we keep as many whole characters of a long word as fit in 49 bytes
+// and skip over the rest of it.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "Tokenizer.h"
+#include <iostream>
+
+Tokenizer::Tokenizer(const char* path, bool foldCase)
+{
+	// constructor -- we open the file in binary mode, just like listing 2 does, and
+	// fill in our byte tables so that nextWord never has to compare a byte to a list.
+	//
+	inFile.open(path, ios::binary);
+
+	this->path = path;
+	buffer = new char[BUFFER_SIZE];
+	this->foldCase = foldCase;
+
+	for (int b = 0; b < 256; b++) // Every byte starts out as a word byte that stays the same,
+	{
+		byteClasses[b] = b < 128 ? WORD_BYTE : MULTIBYTE_BYTE; // except for UTF-8 bytes, which we decode.
+		foldedBytes[b] = (unsigned char)b;
+
+		if (foldCase && b >= 'A' && b <= 'Z') // If we are folding, uppercase letters become lowercase.
+		{
+			foldedBytes[b] = (unsigned char)(b + ('a' - 'A'));
+		}
+	}
+
+	// These are the delimiters from listing 2 of the lab PDF.
+	const char delimiters[] = { ' ', 10, 13, ',', '.', '\'', ':', ';', '"', '?', '!', '-', '(', ')', '[', ']', '_', '*', 9 };
+
+	for (char d : delimiters)
+	{
+		byteClasses[(unsigned char)d] = DELIMITER_BYTE;
+	}
+}
+
+Tokenizer::~Tokenizer()
+{
+	// On deconstruction, we close the file if we opened it, and delete our buffer.
+	//
+	if (inFile.is_open())
+	{
+		inFile.close();
+	}
+
+	delete[] buffer;
+}
+
+bool Tokenizer::fail()
+{
+	return !inFile.is_open(); // The only way we can fail is by not being able to open the file.
+}
+
+void Tokenizer::describe()
+{
+	cout << "File: " << path << "\n";
+}
+
+bool Tokenizer::fill(size_t count)
+{
+	// This method makes sure there are at least count unread bytes in the buffer. If there
+	// aren't, we move the unread bytes to the front of the buffer and read as much of the
+	// file as fits behind them. It returns false if the file ran out before we had enough.
+	//
+	if (length - position >= count) // If we already have enough bytes, there is nothing to do.
+	{
+		return true;
+	}
+
+	size_t unread = length - position;
+
+	memmove(buffer, buffer + position, unread); // We keep the bytes we haven't used yet,
+
+	position = 0;
+	length = unread;
+
+	if (inFile.is_open() && inFile) // and read more of the file behind them.
+	{
+		inFile.read(buffer + length, BUFFER_SIZE - length);
+		length += (size_t)inFile.gcount();
+	}
+
+	return length >= count;
+}
+
+long Tokenizer::decode(size_t& length)
+{
+	// This method decodes the UTF-8 sequence at the current position. The first byte tells us
+	// how many continuation bytes (10xxxxxx) follow it. Overlong encodings, surrogates and
+	// code points past U+10FFFF aren't valid, so we return -1 for them as well.
+	//
+	const unsigned char* bytes = (const unsigned char*)buffer + position;
+	size_t available = this->length - position;
+	long codePoint;
+	long minimum;
+
+	length = 1; // Invalid bytes are used up one at a time.
+
+	if (bytes[0] >= 0xC2 && bytes[0] <= 0xDF)		// 110xxxxx starts a two byte sequence,
+	{
+		length = 2;
+		codePoint = bytes[0] & 0x1F;
+		minimum = 0x80;
+	}
+	else if (bytes[0] >= 0xE0 && bytes[0] <= 0xEF)	// 1110xxxx starts a three byte sequence,
+	{
+		length = 3;
+		codePoint = bytes[0] & 0x0F;
+		minimum = 0x800;
+	}
+	else if (bytes[0] >= 0xF0 && bytes[0] <= 0xF4)	// and 11110xxx starts a four byte sequence.
+	{
+		length = 4;
+		codePoint = bytes[0] & 0x07;
+		minimum = 0x10000;
+	}
+	else											// Anything else can't start a sequence.
+	{
+		return -1;
+	}
+
+	if (available < length) // If the file ends in the middle of the sequence, it isn't valid.
+	{
+		length = 1;
+
+		return -1;
+	}
+
+	for (size_t i = 1; i < length; i++) // Each continuation byte adds six more bits.
+	{
+		if ((bytes[i] & 0xC0) != 0x80)
+		{
+			length = 1;
+
+			return -1;
+		}
+
+		codePoint = (codePoint << 6) | (bytes[i] & 0x3F);
+	}
+
+	if (codePoint < minimum || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+	{
+		length = 1;
+
+		return -1;
+	}
+
+	return codePoint;
+}
+
+bool Tokenizer::isUnicodeDelimiter(long codePoint)
+{
+	// These are the non-ASCII characters that separate words: the no-break space, the
+	// Latin-1 punctuation that shows up in text (inverted marks and angle quotes), the
+	// General Punctuation block (spaces, dashes, curly quotes, ellipses and so on), the
+	// CJK Symbols and Punctuation block, and the byte order mark.
+	//
+	return codePoint == 0xA0 || codePoint == 0xA1 || codePoint == 0xAB || codePoint == 0xBB || codePoint == 0xBF ||
+		(codePoint >= 0x2000 && codePoint <= 0x206F) ||
+		(codePoint >= 0x3000 && codePoint <= 0x303F) ||
+		codePoint == 0xFEFF;
+}
+
+long Tokenizer::foldCodePoint(long codePoint)
+{
+	// This method returns the lowercase form of a letter, or the code point itself if it
+	// isn't an uppercase letter we know about.
+	//
+	if (codePoint >= 0xC0 && codePoint <= 0xDE && codePoint != 0xD7)	// Latin-1 capitals (but not the multiplication sign)
+	{
+		return codePoint + 0x20;
+	}
+
+	if (codePoint == 0x130)	// Capital I with a dot above lowercases to a plain i, not the dotless i after it.
+	{
+		return 'i';
+	}
+
+	if ((codePoint >= 0x100 && codePoint <= 0x137) || (codePoint >= 0x14A && codePoint <= 0x177)) // Latin Extended-A pairs
+	{
+		return codePoint | 1;	// whose capitals are even,
+	}
+
+	if ((codePoint >= 0x139 && codePoint <= 0x148) || (codePoint >= 0x179 && codePoint <= 0x17E))
+	{
+		return (codePoint & 1) ? codePoint + 1 : codePoint; // and pairs whose capitals are odd.
+	}
+
+	if (codePoint == 0x178)	// Y with diaeresis is the odd one out, since its lowercase form is in Latin-1.
+	{
+		return 0xFF;
+	}
+
+	if (codePoint >= 0x391 && codePoint <= 0x3A9 && codePoint != 0x3A2) // Greek capitals
+	{
+		return codePoint + 0x20;
+	}
+
+	if (codePoint >= 0x410 && codePoint <= 0x42F) // Cyrillic capitals
+	{
+		return codePoint + 0x20;
+	}
+
+	if (codePoint >= 0x400 && codePoint <= 0x40F) // and the Cyrillic capitals with marks.
+	{
+		return codePoint + 0x50;
+	}
+
+	return codePoint;
+}
+
+size_t Tokenizer::encode(long codePoint, char bytes[4])
+{
+	// This method writes a code point back out as UTF-8, returning the number of bytes it took.
+	//
+	if (codePoint < 0x80)
+	{
+		bytes[0] = (char)codePoint;
+
+		return 1;
+	}
+
+	if (codePoint < 0x800)
+	{
+		bytes[0] = (char)(0xC0 | (codePoint >> 6));
+		bytes[1] = (char)(0x80 | (codePoint & 0x3F));
+
+		return 2;
+	}
+
+	if (codePoint < 0x10000)
+	{
+		bytes[0] = (char)(0xE0 | (codePoint >> 12));
+		bytes[1] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+		bytes[2] = (char)(0x80 | (codePoint & 0x3F));
+
+		return 3;
+	}
+
+	bytes[0] = (char)(0xF0 | (codePoint >> 18));
+	bytes[1] = (char)(0x80 | ((codePoint >> 12) & 0x3F));
+	bytes[2] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+	bytes[3] = (char)(0x80 | (codePoint & 0x3F));
+
+	return 4;
+}
+
+bool Tokenizer::nextWord(char word[50])
+{
+	// This method reads bytes until it has a whole word. We skip over any delimiters in
+	// front of the word, then keep every character up to the next delimiter (or the end of
+	// the file). Since we skip runs of delimiters, we never hand back an empty word. Once a
+	// character doesn't fit in the word, we drop it and every character after it, so a
+	// long word never ends with part of a multibyte character.
+	//
+	size_t wordLength = 0;		// The number of bytes in the word so far
+	bool truncated = false;		// Whether or not we have started dropping characters
+
+	memset(word, 0, 50); // zero the word buffer
+
+	while (true)
+	{
+		if (position == length && !fill(1)) // If we have used up the buffer and there is no more file,
+		{
+			return wordLength > 0;			// we are done, and we have a word if we had started one.
+		}
+
+		unsigned char b = (unsigned char)buffer[position];
+		byteClass type = byteClasses[b];
+
+		if (type == WORD_BYTE) // ASCII word characters are the common case, so we handle a whole run of them here.
+		{
+			do
+			{
+				if (wordLength < 49 && !truncated)
+				{
+					word[wordLength++] = (char)foldedBytes[b];
+				}
+				else
+				{
+					truncated = true;
+				}
+
+				position++;
+			} while (position < length && byteClasses[b = (unsigned char)buffer[position]] == WORD_BYTE);
+
+			continue;
+		}
+
+		size_t sequenceLength = 1;
+		long codePoint = -1;
+
+		if (type == MULTIBYTE_BYTE) // If this byte starts a UTF-8 sequence, we decode it to find out what it is.
+		{
+			fill(4); // We make sure the whole sequence is in the buffer (fill can move the buffer around),
+
+			codePoint = decode(sequenceLength);
+
+			if (codePoint != -1 && isUnicodeDelimiter(codePoint)) // and Unicode punctuation is a delimiter like any other.
+			{
+				type = DELIMITER_BYTE;
+			}
+		}
+
+		if (type == DELIMITER_BYTE) // A delimiter ends the word we are on, if we have one.
+		{
+			position += sequenceLength;
+
+			if (wordLength > 0)
+			{
+				return true;
+			}
+
+			continue;
+		}
+
+		// At this point, we have a non-ASCII character that belongs in the word. If it decoded,
+		// we fold it if we have to and write it back out. If it didn't, we keep the raw byte.
+		char bytes[4];
+		size_t byteCount;
+
+		if (codePoint != -1)
+		{
+			byteCount = encode(foldCase ? foldCodePoint(codePoint) : codePoint, bytes);
+		}
+		else
+		{
+			bytes[0] = buffer[position];
+			byteCount = 1;
+		}
+
+		if (wordLength + byteCount <= 49 && !truncated) // If the whole character fits, we keep it.
+		{
+			memcpy(word + wordLength, bytes, byteCount);
+			wordLength += byteCount;
+		}
+		else
+		{
+			truncated = true;
+		}
+
+		position += sequenceLength;
+	}
+}
@@ -0,0 +1,73 @@
+//==============================================================================================
+// File: Tokenizer.h - Input file tokenizer
+// Header for Tokenizer.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <cstring>
+#include <fstream>
+#include "WordSource.h"
+
+using namespace std;
+
+class Tokenizer : public WordSource
+{
+public:
+	// Opens the file at the given path for reading words out of. If foldCase is true,
+	// every word is lowercased, so that "The" and "the" are read as the same word.
+	Tokenizer(const char* path, bool foldCase = false);
+	~Tokenizer();
+
+	// A tokenizer owns its buffer and its open file, so it can't be copied: both copies would
+	// free the same buffer when they were deconstructed.
+	Tokenizer(const Tokenizer&) = delete;
+	Tokenizer& operator=(const Tokenizer&) = delete;
+
+	bool fail(); // Returns true if the file couldn't be opened
+
+	void describe(); // Prints out the path of the file
+
+	// Reads the next word of the file into the given buffer, returning false once there are no
+	// more words. Words longer than 49 bytes are cut off at the last whole character that fits.
+	bool nextWord(char word[50]);
+private:
+	// The kind of each byte. A word byte is an ASCII character that belongs in a word, a delimiter
+	// byte is an ASCII character that separates words, and a multibyte byte is the start (or a
+	// stray piece) of a UTF-8 sequence, which we have to decode before we know which it is.
+	enum byteClass : unsigned char
+	{
+		WORD_BYTE,
+		DELIMITER_BYTE,
+		MULTIBYTE_BYTE
+	};
+
+	static const size_t BUFFER_SIZE = 65536; // The number of bytes we read from the file at a time
+
+	bool fill(size_t count); // Makes sure at least count unread bytes are in the buffer, if the file has that many left
+
+	// Decodes the UTF-8 sequence at the current position, setting length to its number of bytes.
+	// Returns -1 (with a length of one) if the bytes there aren't a valid sequence.
+	long decode(size_t& length);
+
+	static bool isUnicodeDelimiter(long codePoint); // Returns true if the given code point is punctuation or a space
+	static long foldCodePoint(long codePoint); // Returns the lowercase form of the given code point
+	static size_t encode(long codePoint, char bytes[4]); // Writes the UTF-8 bytes of the given code point, returning how many there are
+
+	ifstream inFile;				// The file we are reading words from
+	const char* path;				// The path of that file
+	char* buffer;					// The bytes of the file we have read but not used yet
+	size_t position = 0;			// The index of the next unused byte in the buffer
+	size_t length = 0;				// The number of bytes in the buffer
+	bool foldCase;					// Whether or not we lowercase each word
+
+	byteClass byteClasses[256];		// The class of every byte value
+	unsigned char foldedBytes[256];	// The byte each ASCII byte becomes in a word (lowercased if we are folding)
+};
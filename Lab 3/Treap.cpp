@@ -0,0 +1,447 @@
+//==============================================================================================
+// File: Treap.cpp - Frequency treap implementation
+// c.f.: Treap.h
+//
+// A treap is a binary search tree by word and, at the same time, a heap by priority: every
+// node's priority is at least as high as its children's, so the highest priority node is the
+// root. In a normal treap the priorities are random, which keeps the tree balanced on average.
+// Here, a word's priority is its count (with a random number to break ties between words with
+// the same count), so the most frequent words are always at the top of the tree, and the rare
+// words, which all have about the same count, are arranged at random below them like a normal
+// treap. With text, where a handful of words make up most of what we read, most inserts are
+// of words that are only a few nodes down.
+//
+// Each time a word's count goes up, it might now outrank its parent, in which case we rotate
+// it up until it doesn't. New words start with a count of one, so they only go up past other
+// words that have only been seen once and lost the tie break.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#include "Treap.h"
+
+Treap::Treap() : Treap((unsigned long long)time(NULL))
+{
+	// constructor -- without a seed, we use the current time, like the skip list does.
+}
+
+Treap::Treap(unsigned long long seed) : generator((unsigned int)(seed ^ (seed >> 32)))
+{
+	// constructor -- there's nothing to do other than seeding the generator, which we did above.
+}
+
+Treap::~Treap()
+{
+	// On deconstruction, we delete every node, keeping the nodes we still have to delete on a
+	// stack of our own like the BST does.
+	//
+	vector<node*> stack;
+
+	if (root != nullptr)
+	{
+		stack.push_back(root);
+	}
+
+	while (!stack.empty())
+	{
+		node* p = stack.back();
+		stack.pop_back();
+
+		if (p->leftChild != nullptr)
+		{
+			stack.push_back(p->leftChild);
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(p->rightChild);
+		}
+
+		delete p;
+	}
+
+	root = nullptr;
+}
+
+bool Treap::outranks(node* a, node* b)
+{
+	return a->count != b->count ? a->count > b->count : a->tieBreak > b->tieBreak;
+}
+
+void Treap::rotateUp(size_t depth)
+{
+	// This method rotates x = path[depth] above its parent p. If x is p's left child, that's a
+	// right rotation: x's right subtree becomes p's left subtree and p becomes x's right child.
+	// Otherwise it's the mirror image. Then x takes p's place under the grandparent, and we
+	// update the path so that it still runs from the root down to x.
+	//
+	node* x = path[depth];
+	node* p = path[depth - 1];
+
+	if (p->leftChild == x)
+	{
+		p->leftChild = x->rightChild;
+		x->rightChild = p;
+		numberOfRightRotations++;
+	}
+	else
+	{
+		p->rightChild = x->leftChild;
+		x->leftChild = p;
+		numberOfLeftRotations++;
+	}
+
+	if (depth == 1) // If p was the root, x is now.
+	{
+		root = x;
+	}
+	else if (path[depth - 2]->leftChild == p)
+	{
+		path[depth - 2]->leftChild = x;
+	}
+	else
+	{
+		path[depth - 2]->rightChild = x;
+	}
+
+	path[depth - 1] = x; // x is now where p was on the path, and p is off of it.
+	path.pop_back();
+
+	numberOfReferenceChanges += 3;
+}
+
+void Treap::insert(const char word[50])
+{
+	// To add a word, we look for it like in the BST, remembering the path we took. If we find
+	// it, its count goes up; otherwise, we add a new node with a count of one where the search
+	// ended. Either way, the node's priority might now be higher than its parent's, so we rotate
+	// it up until it isn't.
+	//
+	node* p = root;
+	int compareValue = 0;
+
+	path.clear();
+
+	while (p != nullptr) // as long as there are more nodes:
+	{
+		path.push_back(p);
+
+		numberOfKeyComparisonsMade++;
+		compareValue = strcmp(word, p->word);
+
+		if (compareValue == 0) // If we found the word,
+		{
+			break;
+		}
+
+		p = compareValue < 0 ? p->leftChild : p->rightChild; // Otherwise, we go left or right.
+	}
+
+	if (p != nullptr) // If we found the word, we count it.
+	{
+		insertDepths.record(path.size());
+
+		p->count++;
+	}
+	else // Otherwise, the new node goes under the last node on the path.
+	{
+		insertDepths.record(path.size());
+
+		p = new node();
+
+		strcpy(p->word, word);
+		p->tieBreak = generator();
+
+		if (path.empty())
+		{
+			root = p;
+		}
+		else if (compareValue < 0)
+		{
+			path.back()->leftChild = p;
+		}
+		else
+		{
+			path.back()->rightChild = p;
+		}
+
+		path.push_back(p);
+
+		numberOfReferenceChanges++;
+	}
+
+	bool promoted = false;
+
+	while (path.size() > 1) // As long as the node has a parent,
+	{
+		numberOfPriorityComparisons++;
+
+		if (!outranks(p, path[path.size() - 2])) // we stop once the parent outranks it,
+		{
+			break;
+		}
+
+		rotateUp(path.size() - 1); // and otherwise rotate it up above its parent.
+		promoted = true;
+	}
+
+	if (promoted && p->count > 1) // We keep track of how often a word's count, not its tie break, moved it up.
+	{
+		numberOfPromotions++;
+	}
+}
+
+void Treap::list()
+{
+	// This method prints out the nodes in a nicely formatted list with indexes and the node's word
+	// and count, doing the in-order traversal with a stack of our own.
+	//
+	if (root == nullptr) // If the root is nullptr, than there is nothing in the tree,
+	{
+		cout << "Set is empty" << endl; // so we just print out "Set is empty"
+
+		return;
+	}
+
+	cout << "Set contains: ";
+
+	vector<node*> stack; // The nodes we have gone left of but not printed yet
+	node* p = root;
+	int index = 0;
+
+	while (p != nullptr || !stack.empty())
+	{
+		while (p != nullptr) // We go as far left as we can, remembering the nodes we pass,
+		{
+			stack.push_back(p);
+			p = p->leftChild;
+		}
+
+		p = stack.back(); // then print the last one we passed,
+		stack.pop_back();
+
+		if (index != 0)
+		{
+			cout << ", ";
+		}
+
+		cout << "(" << ++index << ") " << p->word << " " << p->count;
+
+		p = p->rightChild; // and move on to its right subtree.
+	}
+
+	cout << endl;
+}
+
+void Treap::calculateNumWords(unsigned long long& numWords, unsigned long long& numUniqueWords)
+{
+	// This method visits every node with a stack of our own, counting its word and its count.
+	//
+	vector<node*> stack;
+
+	numWords = 0;
+	numUniqueWords = 0;
+
+	if (root != nullptr)
+	{
+		stack.push_back(root);
+	}
+
+	while (!stack.empty())
+	{
+		node* p = stack.back();
+		stack.pop_back();
+
+		numWords += p->count;
+		numUniqueWords++;
+
+		if (p->leftChild != nullptr)
+		{
+			stack.push_back(p->leftChild);
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(p->rightChild);
+		}
+	}
+}
+
+unsigned int Treap::depthOf(const char* word) const
+{
+	// This method walks down the tree like a binary search tree lookup, only keeping track of how deep it is.
+	//
+	node* p = root;
+	unsigned int depth = 1;
+
+	while (p != nullptr)
+	{
+		int compareValue = strcmp(word, p->word);
+
+		if (compareValue == 0)
+		{
+			return depth;
+		}
+
+		p = compareValue < 0 ? p->leftChild : p->rightChild;
+		depth++;
+	}
+
+	return 0;
+}
+
+vector<WordCount> Treap::topK(size_t k) const
+{
+	// We gather every node's word and count with a stack of our own and keep the k most frequent.
+	//
+	vector<WordCount> allWords;
+	vector<node*> stack;
+
+	if (root != nullptr)
+	{
+		stack.push_back(root);
+	}
+
+	while (!stack.empty())
+	{
+		node* p = stack.back();
+		stack.pop_back();
+
+		allWords.push_back({ p->word, p->count });
+
+		if (p->leftChild != nullptr)
+		{
+			stack.push_back(p->leftChild);
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(p->rightChild);
+		}
+	}
+
+	return selectTopK(allWords, k);
+}
+
+unsigned int Treap::getHeight()
+{
+	// This method finds the deepest node by visiting every node along with its depth.
+	//
+	vector<pair<node*, unsigned int>> stack;
+	unsigned int height = 0;
+
+	if (root != nullptr)
+	{
+		stack.push_back(make_pair(root, 1u));
+	}
+
+	while (!stack.empty())
+	{
+		node* p = stack.back().first;
+		unsigned int depth = stack.back().second;
+		stack.pop_back();
+
+		height = depth > height ? depth : height;
+
+		if (p->leftChild != nullptr)
+		{
+			stack.push_back(make_pair(p->leftChild, depth + 1));
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(make_pair(p->rightChild, depth + 1));
+		}
+	}
+
+	return height;
+}
+
+unsigned long long Treap::getKeyComparisons()
+{
+	return numberOfKeyComparisonsMade;
+}
+
+unsigned long long Treap::getReferenceChanges()
+{
+	return numberOfReferenceChanges;
+}
+
+unsigned long long Treap::getMemoryUsage()
+{
+	unsigned long long numWords, numUniqueWords;
+
+	calculateNumWords(numWords, numUniqueWords);
+
+	return numUniqueWords * sizeof(node);
+}
+
+unsigned long long Treap::getAllocatedBytes()
+{
+	// This method adds up how big the allocator says each node's block really is.
+	//
+	unsigned long long bytes = 0;
+	vector<node*> stack;
+
+	if (root != nullptr)
+	{
+		stack.push_back(root);
+	}
+
+	while (!stack.empty())
+	{
+		node* p = stack.back();
+		stack.pop_back();
+
+		bytes += MemoryUsage::allocatedSize(p);
+
+		if (p->leftChild != nullptr)
+		{
+			stack.push_back(p->leftChild);
+		}
+
+		if (p->rightChild != nullptr)
+		{
+			stack.push_back(p->rightChild);
+		}
+	}
+
+	return bytes;
+}
+
+void Treap::displayStatistics()
+{
+	// This method displays statistics related to the number of words in the tree and the
+	// rotations done as words are inserted and counted.
+	//
+	unsigned long long numWords, numUniqueWords;
+
+	calculateNumWords(numWords, numUniqueWords);
+
+	unsigned long long liveBytes = getMemoryUsage(); // We also find out how much memory the nodes take up,
+	unsigned long long allocatedBytes = getAllocatedBytes(); // and how much the allocator really set aside for them.
+
+	cout << "Treap Stats:\n"; // Print out a header specifying that these are treap stats
+	cout << "Distinct Words: " << numUniqueWords << "\n"; // Print out the total number of unique words
+	cout << "Total Words: " << numWords << "\n"; // Print out the total number of words
+	cout << "Height: " << getHeight() << "\n"; // Print out the height of the tree
+	cout << "Node Size: " << sizeof(node) << " bytes\n"; // Print out how big a single node is
+	cout << "Live Bytes: " << liveBytes << "\n"; // Print out the number of bytes the nodes take up
+	cout << "Allocated Bytes: " << allocatedBytes << "\n"; // Print out the number of bytes the allocator set aside for them
+	cout << "Allocator Overhead: " << (allocatedBytes > liveBytes ? allocatedBytes - liveBytes : 0) << " bytes\n"; // Print out how much of that is rounding
+	cout << "Bytes per Distinct Word: " << (numUniqueWords > 0 ? (double)allocatedBytes / numUniqueWords : 0) << "\n"; // Print out what each distinct word costs
+	cout << "Reference Changes: " << numberOfReferenceChanges << "\n"; // Print out the total number of reference changes made
+	cout << "Key Comparisons: " << numberOfKeyComparisonsMade << "\n"; // Print out the total number of key comparisons made
+	cout << "Key Comparisons per Word: " << (numWords > 0 ? (double)numberOfKeyComparisonsMade / numWords : 0) << "\n"; // Print out how many comparisons each word took
+	cout << "Priority Comparisons: " << numberOfPriorityComparisons << "\n"; // Print out the number of priority comparisons made
+	cout << "Left Rotations: " << numberOfLeftRotations << "\n"; // Print out the number of left rotations made
+	cout << "Right Rotations: " << numberOfRightRotations << "\n"; // Print out the number of right rotations made
+	cout << "Frequency Promotions: " << numberOfPromotions << "\n"; // Print out the number of times a count moved a word up
+	insertDepths.display("Insert Depths"); // Print out how many nodes each insert looked at
+
+	// Print out where the ten most frequent words are, which is where most of the inserts went.
+	displayWordDepths("Top Word Depths", topK(10), [this](const char* word) { return depthOf(word); });
+}
@@ -0,0 +1,80 @@
+//==============================================================================================
+// File: Treap.h - Frequency treap
+// Header for Treap.cpp
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <cstring>
+#include <iostream>
+#include <time.h>
+#include <vector>
+#include <random>
+#include "Statistics.h"
+#include "MemoryUsage.h"
+#include "DepthHistogram.h"
+
+using namespace std;
+
+class Treap
+{
+public:
+	Treap(); // Constructs a treap whose tie breaking priorities are seeded with the current time
+
+	// Constructs a treap whose tie breaking priorities are seeded with the given seed, so that
+	// the same input always builds the same tree.
+	Treap(unsigned long long seed);
+
+	~Treap();
+
+	void insert(const char word[50]); // adds a word to the tree
+	void list(); // Prints a list of all words in the tree.
+	void displayStatistics(); // Displays statistics about the tree operations performed.
+
+	unsigned long long getKeyComparisons(); // Returns the number of key comparisons made so far
+	unsigned long long getReferenceChanges(); // Returns the number of reference changes made so far
+	unsigned int getHeight(); // Returns the height of the tree
+	unsigned long long getMemoryUsage(); // Returns the number of bytes taken up by the nodes of the tree
+	unsigned long long getAllocatedBytes(); // Returns the number of bytes the allocator set aside for the nodes of the tree
+	vector<WordCount> topK(size_t k) const; // Returns the k most frequent words in the tree, most frequent first
+private:
+	struct node
+	{
+		char word[50] = {};			// The word of the node
+		unsigned int count = 1;		// The amount of times the word has been inserted into the treap, which is its priority
+		unsigned int tieBreak = 0;	// A random number that decides between two nodes with the same count
+		node* leftChild = nullptr;	// A pointer to the left child of the node
+		node* rightChild = nullptr;	// A pointer to the right child of the node
+	};
+
+	static bool outranks(node* a, node* b); // Returns true if node a has a higher priority than node b
+
+	// Rotates the node at path[depth] above its parent, path[depth - 1], and fixes the pointer to it from path[depth - 2] (or the root)
+	void rotateUp(size_t depth);
+
+	// Returns the depth of the word's node, counting the root as 1, or zero if it isn't in the tree. This doesn't count toward any statistics.
+	unsigned int depthOf(const char* word) const;
+
+	// Calculates the number of words and unique words in the treap.
+	void calculateNumWords(unsigned long long& numWords, unsigned long long& numUniqueWords);
+
+	node* root = nullptr; // A pointer to the root of the treap. If this is nullptr, no nodes exist in the tree.
+	vector<node*> path; // The nodes from the root down to the node being inserted, kept between inserts so we don't reallocate it
+	mt19937 generator; // The generator for the tie breaking priorities
+
+	DepthHistogram insertDepths; // How many nodes each insert compared its word against, before any rotations
+
+	statistic numberOfReferenceChanges = 0;		// Keeps track of the number of times the root pointer or child pointers change.
+	statistic numberOfKeyComparisonsMade = 0;	// Keeps track of the number of word key comparisons during tree inserts.
+	statistic numberOfPriorityComparisons = 0;	// Keeps track of the number of times we compared a node's priority against its parent's.
+	statistic numberOfLeftRotations = 0;		// Keeps track of the number of times a node was rotated up from a right child.
+	statistic numberOfRightRotations = 0;		// Keeps track of the number of times a node was rotated up from a left child.
+	statistic numberOfPromotions = 0;			// Keeps track of the number of times a word's new count lifted it above its parent.
+};
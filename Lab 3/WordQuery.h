@@ -0,0 +1,252 @@
+//==============================================================================================
+// File: WordQuery.h - Shared types for ordered word queries
+//
+// Every datatype in this program keeps its words in alphabetical order, so each of them can
+// answer range queries ("every word from lo to hi") and prefix queries ("every word starting
+// with pre") by finding the first word of the answer and stepping forward from there. This
+// header has the pieces those queries have in common: the (word, count) pair an iterator
+// returns, the bound that tells an iterator when to stop, and a range type that lets the
+// results be used in a range-based for loop. It also has the cursor that lets a listing be
+// taken a page at a time, picking up after the last word of the page before.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <cstring>
+#include <vector>
+#include <queue>
+#include <algorithm>
+
+using namespace std;
+
+// A word and the number of times it has been inserted. The word points into the datatype
+// that returned it, so it is only valid until that datatype is changed.
+struct WordCount
+{
+	const char* word;
+	unsigned int count;
+};
+
+// The upper end of a query. An unbounded query never stops early, an upper bound query stops
+// after the last word that is less than or equal to its key, and a prefix query stops after the
+// last word that starts with its key. The key is copied in, since words are never longer than
+// 49 characters and an iterator shouldn't depend on the caller's string staying around.
+struct WordBound
+{
+	enum kind
+	{
+		UNBOUNDED,
+		UPPER_BOUND,
+		PREFIX
+	};
+
+	kind type = UNBOUNDED;	// What kind of bound this is
+	char key[50] = {};		// The upper bound or the prefix
+	size_t keyLength = 0;	// The length of the key, which we need for prefix comparisons
+
+	WordBound() {}
+
+	WordBound(kind type, const char* key)
+	{
+		if (key == nullptr) // A missing key means there is nothing to stop at.
+		{
+			return;
+		}
+
+		this->type = type;
+		keyLength = strlen(key);
+
+		if (keyLength > 49) // Words are at most 49 characters, so that's all of the key we ever need.
+		{
+			keyLength = 49;
+		}
+
+		memcpy(this->key, key, keyLength);
+		this->key[keyLength] = 0;
+
+		if (type == PREFIX && keyLength == 0) // Every word starts with the empty prefix,
+		{
+			this->type = UNBOUNDED; // so it doesn't bound anything.
+		}
+	}
+
+	bool admits(const char* word) const // Returns true if the given word is still inside the bound
+	{
+		switch (type)
+		{
+		case UPPER_BOUND:
+			return strcmp(word, key) <= 0;
+		case PREFIX:
+			return strncmp(word, key, keyLength) == 0;
+		default:
+			return true;
+		}
+	}
+};
+
+// A word and its count, copied out of a datatype. Unlike a WordCount, it stays valid after the
+// datatype changes, so a page of these can be handed to another thread or written out later.
+struct WordEntry
+{
+	char word[50];
+	unsigned int count;
+};
+
+// Where a paged listing is up to. A cursor only remembers the last word it handed out, not a
+// place in the datatype, so it keeps working if words are added or removed between pages (the
+// next page just starts after that word, wherever it is now), and any number of cursors can
+// page through the same datatype at once. A cursor can also be started after any word.
+struct WordCursor
+{
+	char last[50] = {};		// The last word handed out, which the next page starts after
+	bool started = false;	// Whether or not there is a last word, so the first page starts at the first word
+	bool finished = false;	// Whether or not the last page reached the end (the next one still has any words added after it since)
+
+	WordCursor() {}
+
+	WordCursor(const char* after) // Starts the cursor after the given word, which doesn't have to be in the datatype
+	{
+		if (after != nullptr)
+		{
+			strncpy(last, after, 49); // Words are at most 49 characters, so that's all we ever need.
+			started = true;
+		}
+	}
+};
+
+// The number of words list() takes at a time when it pages through a datatype.
+const size_t LIST_PAGE_SIZE = 256;
+
+// Copies up to capacity words into the buffer, starting at next, which is the first word that
+// isn't less than the cursor's last word, and moves the cursor past them. The cursor's own word
+// was handed out on the page before, so we skip it if it is still there. Returns the number of
+// words copied, which is less than capacity only on the last page.
+template <class Iterator>
+size_t fillPage(Iterator next, Iterator end, WordCursor& cursor, WordEntry* buffer, size_t capacity)
+{
+	size_t filled = 0;
+
+	if (next != end && cursor.started && strcmp((*next).word, cursor.last) == 0)
+	{
+		++next;
+	}
+
+	for (; next != end && filled < capacity; ++next, filled++)
+	{
+		WordCount w = *next;
+
+		strcpy(buffer[filled].word, w.word);
+		buffer[filled].count = w.count;
+	}
+
+	if (filled > 0) // The last word we copied is where the next page picks up.
+	{
+		strcpy(cursor.last, buffer[filled - 1].word);
+		cursor.started = true;
+	}
+
+	cursor.finished = next == end;
+
+	return filled;
+}
+
+// Packs the first eight bytes of a word into a number, with the first byte in the highest byte,
+// so that comparing two packed prefixes as numbers gives the same answer strcmp would for their
+// first eight bytes. A word shorter than eight bytes is padded with zeros, which sort before
+// every letter, just like the end of a word does in strcmp. The read-only indexes keep these
+// next to their nodes so that most comparisons are a single integer comparison.
+inline unsigned long long packPrefix(const char* word)
+{
+	unsigned long long prefix = 0;
+	int i = 0;
+
+	for (; i < 8 && word[i] != 0; i++)
+	{
+		prefix = (prefix << 8) | (unsigned char)word[i];
+	}
+
+	if (i == 0) // The empty word is all padding (and shifting by 64 bits isn't allowed).
+	{
+		return 0;
+	}
+
+	return prefix << (8 * (8 - i)); // We shift whatever we packed up to the top of the number.
+}
+
+// Returns true if word a is more frequent than word b. Words with the same count are
+// ordered alphabetically, so that every datatype gives the same answer to a top K query.
+inline bool moreFrequent(const WordCount& a, const WordCount& b)
+{
+	if (a.count != b.count)
+	{
+		return a.count > b.count;
+	}
+
+	return strcmp(a.word, b.word) < 0;
+}
+
+// Returns the k most frequent words of the given range, most frequent first. This takes a
+// single pass over the range, keeping the k most frequent words seen so far in a heap whose
+// top is the least frequent of them, so each word costs at most O(log k) and we never hold
+// more than k words at once.
+template <class Range>
+vector<WordCount> selectTopK(const Range& range, size_t k)
+{
+	// A priority_queue keeps its "largest" element on top, so by comparing with moreFrequent
+	// the element on top is the least frequent word we are keeping.
+	priority_queue<WordCount, vector<WordCount>, bool (*)(const WordCount&, const WordCount&)> heap(moreFrequent);
+
+	if (k == 0) // There is nothing to do if nobody wants any words.
+	{
+		return vector<WordCount>();
+	}
+
+	for (WordCount w : range)	// For each word in the range,
+	{
+		if (heap.size() < k)	// if we don't have k words yet, we keep it.
+		{
+			heap.push(w);
+		}
+		else if (moreFrequent(w, heap.top())) // Otherwise, we only keep it if it beats the least frequent word we have,
+		{
+			heap.pop();		// which it replaces.
+			heap.push(w);
+		}
+	}
+
+	vector<WordCount> result; // We now empty the heap, least frequent word first,
+
+	result.reserve(heap.size());
+
+	while (!heap.empty())
+	{
+		result.push_back(heap.top());
+		heap.pop();
+	}
+
+	reverse(result.begin(), result.end()); // and reverse it so that the most frequent word comes first.
+
+	return result;
+}
+
+// A pair of iterators returned by a query, so that its results can be looped over with
+// for (WordCount w : tree->prefixQuery("pre")) { ... }
+template <class Iterator>
+class WordRange
+{
+public:
+	WordRange(Iterator first, Iterator last) : first(first), last(last) {}
+
+	Iterator begin() const { return first; }
+	Iterator end() const { return last; }
+private:
+	Iterator first;	// The first word of the results
+	Iterator last;	// The end iterator, one past the last word of the results
+};
@@ -0,0 +1,28 @@
+//==============================================================================================
+// File: WordSource.h - A stream of words to insert
+//
+// The driver doesn't care where its words come from, so every benchmark pass reads them from
+// a WordSource. The Tokenizer reads the words of a file, and the CorpusGenerator makes up a
+// synthetic corpus, so the same passes can run over either one.
+//
+// Author:     Nicholas Nassar, University of Toledo
+// Class:      EECS 2510-001 Non-Linear Data Structures, Spring 2020
+// Instructor: Dr.Thomas
+// Date:       Apr 4, 2020
+// Copyright:  Copyright 2020 by Nicholas Nassar. All rights reserved.
+
+#pragma once
+
+class WordSource
+{
+public:
+	virtual ~WordSource() {}
+
+	virtual bool fail() { return false; } // Returns true if the source couldn't be opened
+
+	virtual void describe() = 0; // Prints out a line saying where the words are coming from
+
+	// Copies the next word into the given buffer, returning false once there are no more words.
+	// A word is never empty and never longer than 49 bytes.
+	virtual bool nextWord(char word[50]) = 0;
+};